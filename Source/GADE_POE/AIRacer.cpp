@@ -5,6 +5,7 @@
  */
 
 #include "AIRacer.h"
+#include "GADE_POE.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "RacerTypes.h"
@@ -13,6 +14,8 @@
 #include "AIRacerContoller.h"
 #include "Kismet/GameplayStatics.h"
 #include "BiginnerRaceGameState.h"
+#include "RacerProximitySubsystem.h"
+#include "AIRacerSimulationManager.h"
 #include "NavigationSystem.h"
 #include "AI/Navigation/NavigationTypes.h"
 
@@ -57,6 +60,8 @@ AAIRacer::AAIRacer()
     RacerType = ERacerType::Medium;
     MaxSpeed = 600.0f;
     MaxAcceleration = 500.0f;
+    Proximity = nullptr;
+    SimulationManager = nullptr;
 }
 
 void AAIRacer::BeginPlay()
@@ -72,8 +77,34 @@ void AAIRacer::BeginPlay()
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacer: Failed to find BeginnerRaceGameState."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacer: Failed to find BeginnerRaceGameState."));
     }
+
+    Proximity = GetWorld()->GetSubsystem<URacerProximitySubsystem>();
+    if (Proximity)
+    {
+        Proximity->RegisterRacer(this);
+    }
+
+    SimulationManager = AAIRacerSimulationManager::Get(GetWorld());
+    if (SimulationManager)
+    {
+        SimulationManager->RegisterRacer(this);
+    }
+}
+
+void AAIRacer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (SimulationManager)
+    {
+        SimulationManager->UnregisterRacer(this);
+    }
+    if (Proximity)
+    {
+        Proximity->UnregisterRacer(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AAIRacer::SetupRacerAttributes()
@@ -108,6 +139,7 @@ void AAIRacer::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    // Only runs when no simulation manager took this racer over
     // Update racing behavior
     UpdateRacingBehavior(DeltaTime);
 
@@ -117,54 +149,58 @@ void AAIRacer::Tick(float DeltaTime)
     if (LogTimer >= 1.0f)
     {
         LogTimer = 0.0f;
+        UpdateNavMeshHeight(DeltaTime);
+    }
+}
 
-        UCharacterMovementComponent* Movement = GetCharacterMovement();
-        if (Movement)
-        {
-            // Get current state
-            FVector Velocity = Movement->Velocity;
-            float Speed = Velocity.Size();
-            FVector Location = GetActorLocation();
-            FRotator Rotation = GetActorRotation();
+void AAIRacer::UpdateNavMeshHeight(float DeltaTime)
+{
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    if (Movement)
+    {
+        // Get current state
+        FVector Velocity = Movement->Velocity;
+        float Speed = Velocity.Size();
+        FVector Location = GetActorLocation();
+        FRotator Rotation = GetActorRotation();
 
-            // Check nav mesh position
-            UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
-            if (NavSystem)
+        // Check nav mesh position
+        UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+        if (NavSystem)
+        {
+            ANavigationData* NavData = NavSystem->GetDefaultNavDataInstance();
+            if (NavData)
             {
-                ANavigationData* NavData = NavSystem->GetDefaultNavDataInstance();
-                if (NavData)
+                FNavLocation ProjectedLocation;
+                bool bOnNavMesh = NavSystem->ProjectPointToNavigation(Location, ProjectedLocation, NavData->GetDefaultQueryExtent());
+                float HeightDiff = FMath::Abs(Location.Z - ProjectedLocation.Location.Z);
+                
+                // Log nav mesh status
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("AIRacer %s Nav Mesh Status:"), *GetName());
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("  - On Nav Mesh: %s"), bOnNavMesh ? TEXT("Yes") : TEXT("No"));
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Current Height: %.2f"), Location.Z);
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Nav Mesh Height: %.2f"), ProjectedLocation.Location.Z);
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Height Difference: %.2f"), HeightDiff);
+                
+                // Fix height if needed
+                if (!bOnNavMesh || HeightDiff > 100.0f)
                 {
-                    FNavLocation ProjectedLocation;
-                    bool bOnNavMesh = NavSystem->ProjectPointToNavigation(Location, ProjectedLocation, NavData->GetDefaultQueryExtent());
-                    float HeightDiff = FMath::Abs(Location.Z - ProjectedLocation.Location.Z);
-                    
-                    // Log nav mesh status
-                    UE_LOG(LogTemp, Warning, TEXT("AIRacer %s Nav Mesh Status:"), *GetName());
-                    UE_LOG(LogTemp, Warning, TEXT("  - On Nav Mesh: %s"), bOnNavMesh ? TEXT("Yes") : TEXT("No"));
-                    UE_LOG(LogTemp, Warning, TEXT("  - Current Height: %.2f"), Location.Z);
-                    UE_LOG(LogTemp, Warning, TEXT("  - Nav Mesh Height: %.2f"), ProjectedLocation.Location.Z);
-                    UE_LOG(LogTemp, Warning, TEXT("  - Height Difference: %.2f"), HeightDiff);
+                    GADE_LOG_RATE_LIMITED(LogGADERaceAI, Warning, 1.0, TEXT("AIRacer %s may be off nav mesh or too far above/below it (%.2f)"), *GetName(), HeightDiff);
                     
-                    // Fix height if needed
-                    if (!bOnNavMesh || HeightDiff > 100.0f)
+                    if (bOnNavMesh)
                     {
-                        UE_LOG(LogTemp, Error, TEXT("  - WARNING: Racer may be off nav mesh or too far above/below!"));
+                        // Smoothly move to correct height
+                        FVector TargetLocation = GetActorLocation();
+                        TargetLocation.Z = ProjectedLocation.Location.Z + 50.0f;
                         
-                        if (bOnNavMesh)
-                        {
-                            // Smoothly move to correct height
-                            FVector TargetLocation = GetActorLocation();
-                            TargetLocation.Z = ProjectedLocation.Location.Z + 50.0f;
-                            
-                            FVector NewLocation = FMath::VInterpTo(
-                                GetActorLocation(),
-                                TargetLocation,
-                                DeltaTime,
-                                2.0f
-                            );
-                            
-                            SetActorLocation(NewLocation);
-                        }
+                        FVector NewLocation = FMath::VInterpTo(
+                            GetActorLocation(),
+                            TargetLocation,
+                            DeltaTime,
+                            2.0f
+                        );
+                        
+                        SetActorLocation(NewLocation);
                     }
                 }
             }
@@ -214,23 +250,13 @@ void AAIRacer::UpdateRacingBehavior(float DeltaTime)
     }
 
     // Handle collision avoidance
-    if (Movement->bUseRVOAvoidance)
+    if (Movement->bUseRVOAvoidance && Proximity)
     {
-        TArray<AActor*> NearbyRacers;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AAIRacer::StaticClass(), NearbyRacers);
-        
-        for (AActor* OtherActor : NearbyRacers)
+        // Grid lookup of neighbouring cells only, the grid is shared by all racers this frame
+        if (Proximity->AnyWithinRadius(GetActorLocation(), Movement->AvoidanceConsiderationRadius, this))
         {
-            if (OtherActor != this)
-            {
-                float Distance = FVector::Distance(GetActorLocation(), OtherActor->GetActorLocation());
-                if (Distance < Movement->AvoidanceConsiderationRadius)
-                {
-                    // Increase avoidance when near others
-                    Movement->AvoidanceWeight = FMath::Min(Movement->AvoidanceWeight + DeltaTime, 1.0f);
-                    break;
-                }
-            }
+            // Increase avoidance when near others
+            Movement->AvoidanceWeight = FMath::Min(Movement->AvoidanceWeight + DeltaTime, 1.0f);
         }
     }
 }
@@ -259,21 +285,7 @@ Takes into account both the sharpness of the turn and distance to the corner
  */
 float AAIRacer::CalculateDesiredSpeed(float DistanceToCorner, float CornerAngle)
 {
-    float DesiredSpeed = MaxSpeed;
-
-    // Reduce speed for sharp turns
-    if (CornerAngle > 0.0f)
-    {
-        float AngleRatio = FMath::Clamp(CornerAngle / MaxCorneringAngle, 0.0f, 1.0f);
-        DesiredSpeed *= FMath::Lerp(1.0f, CorneringSpeedMultiplier, AngleRatio);
-    }
-
-    // Brake when approaching corner
-    if (DistanceToCorner < BrakingDistance)
-    {
-        float DistanceRatio = FMath::Clamp(DistanceToCorner / BrakingDistance, 0.0f, 1.0f);
-        DesiredSpeed = FMath::Lerp(MinCorneringSpeed, DesiredSpeed, DistanceRatio);
-    }
-
-    return FMath::Max(DesiredSpeed, MinCorneringSpeed);
+    // Shared with the batched simulation so both paths stay identical
+    return AAIRacerSimulationManager::ComputeDesiredSpeed(DistanceToCorner, CornerAngle, MaxSpeed, MaxCorneringAngle,
+        CorneringSpeedMultiplier, BrakingDistance, MinCorneringSpeed);
 }
\ No newline at end of file
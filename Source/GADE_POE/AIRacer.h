@@ -18,6 +18,8 @@
 // Forward declarations
 class AAIRacerContoller;
 class ABeginnerRaceGameState;
+class URacerProximitySubsystem;
+class AAIRacerSimulationManager;
 
 UCLASS()
 class GADE_POE_API AAIRacer : public ACharacter
@@ -30,6 +32,9 @@ public:
 
     /** Called when the game starts or when spawned */
     virtual void BeginPlay() override;
+
+    /** Called when the racer is removed from the world */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     
     /** Called every frame to update the racer's state */
     virtual void Tick(float DeltaTime) override;
@@ -37,10 +42,21 @@ public:
     /** Initializes the racer's attributes based on its type (Fast, Medium, Slow) */
     void SetupRacerAttributes();
 
+    /** Checks the racer against the nav mesh and eases it back to the right height if it drifted */
+    void UpdateNavMeshHeight(float DeltaTime);
+
     /** Reference to the game state for race management */
     UPROPERTY()
     ABeginnerRaceGameState* GameState;
 
+    /** Shared spatial hash used for avoidance instead of scanning every racer */
+    UPROPERTY()
+    URacerProximitySubsystem* Proximity;
+
+    /** Batches this racer's per-frame behaviour with all the others. The racer's own tick is off while set. */
+    UPROPERTY()
+    AAIRacerSimulationManager* SimulationManager;
+
     /** Defines the type of racer (Fast, Medium, Slow) affecting its performance characteristics */
     UPROPERTY(EditAnywhere, Category = "Racer")
     ERacerType RacerType;
@@ -69,6 +85,9 @@ public:
     UPROPERTY(VisibleAnywhere, Category = "Race")
     int32 WaypointsPassed;
 
+    /** Random stream for this racer's decisions, seeded by the simulation manager */
+    FRandomStream DecisionStream;
+
     /** Current speed of the racer */
     UPROPERTY()
     float CurrentSpeed = 0.0f;
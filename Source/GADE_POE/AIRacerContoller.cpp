@@ -5,6 +5,7 @@
  */
 
 #include "AIRacerContoller.h"
+#include "GADE_POE.h"
 #include "AIRacer.h"
 #include "AdvancedRaceManager.h"
 #include "BiginnerRaceGameState.h"
@@ -14,7 +15,8 @@
 #include "Navigation/PathFollowingComponent.h"
 #include "Waypoint.h"
 #include "WaypointManager.h"
-#include "Kismet/GameplayStatics.h"
+#include "RaceWorldSubsystem.h"
+#include "WaypointArrivalSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -48,93 +50,83 @@ AAIRacerContoller::AAIRacerContoller()
 void AAIRacerContoller::BeginPlay()
 {
     Super::BeginPlay();
-    
-    // Set up retry timer for initialization
-    GetWorld()->GetTimerManager().SetTimer(
-        InitTimerHandle,
-        [this]()
+
+    // Get the game state
+    GameState = Cast<ABeginnerRaceGameState>(GetWorld()->GetGameState());
+    if (!GameState)
+    {
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: Failed to find BeginnerRaceGameState."));
+        return;
+    }
+
+    URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>();
+    if (!RaceServices)
+    {
+        return;
+    }
+
+    // Graph navigation takes over whenever a race manager is ready, the waypoint list is the fallback
+    RaceServices->WhenServiceReady<AAdvancedRaceManager>(this, [this](AAdvancedRaceManager* Manager)
+    {
+        AdvancedRaceManager = Manager;
+        Graph = Manager->GetGraph();
+        if (!Graph)
         {
-            // First try to find AdvancedRaceManager for graph navigation
-            if (!AdvancedRaceManager)
-            {
-                AdvancedRaceManager = Cast<AAdvancedRaceManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AAdvancedRaceManager::StaticClass()));
-            }
+            UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: AdvancedRaceManager has no graph."));
+            return;
+        }
 
-            // If we found AdvancedRaceManager, use graph navigation
-            if (AdvancedRaceManager)
-            {
-                if (!Graph)
-                {
-                    Graph = AdvancedRaceManager->GetGraph();
-                }
-
-                if (!Graph)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Waiting for Graph initialization..."));
-                    return; // Will try again next tick
-                }
-
-                // Clear the timer since we've successfully initialized
-                GetWorld()->GetTimerManager().ClearTimer(InitTimerHandle);
-                
-                // Get the game state
-                GameState = Cast<ABeginnerRaceGameState>(GetWorld()->GetGameState());
-                if (!GameState)
-                {
-                    UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Failed to find BeginnerRaceGameState."));
-                    return;
-                }
-
-                // Set up graph navigation
-                bUseGraphNavigation = true;
-                InitializeGraphNavigation();
-                
-                UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Successfully initialized with graph navigation"));
-                return;
-            }
-            
-            // If no AdvancedRaceManager found, fall back to waypoint navigation
-            if (!WaypointManager)
-            {
-                WaypointManager = Cast<AWaypointManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AWaypointManager::StaticClass()));
-            }
-            
-            if (!WaypointManager || !WaypointManager->WaypointList || WaypointManager->WaypointList->GetCount() == 0)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Waiting for WaypointManager initialization..."));
-                return; // Will try again next tick
-            }
-            
-            // Clear the timer since we've successfully initialized
-            GetWorld()->GetTimerManager().ClearTimer(InitTimerHandle);
-            
-            // Get the game state
-            GameState = Cast<ABeginnerRaceGameState>(GetWorld()->GetGameState());
-            if (!GameState)
-            {
-                UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Failed to find BeginnerRaceGameState."));
-                return;
-            }
-            
-            // Initialize waypoints
-            LinkedList = WaypointManager->WaypointList;
-            CurrentWaypoint = Cast<AWaypoint>(LinkedList->GetFirst());
-            
-            if (!CurrentWaypoint)
-            {
-                UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: No valid first waypoint."));
-                return;
-            }
-            
-            // Set up waypoint navigation
-            bUseGraphNavigation = false;
-            InitializeWaypointNavigation();
-            
-            UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Successfully initialized with waypoint navigation"));
-        },
-        0.1f, // Check every 0.1 seconds
-        true   // Loop until successful
-    );
+        // Set up graph navigation
+        bUseGraphNavigation = true;
+        InitializeGraphNavigation();
+
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Successfully initialized with graph navigation"));
+    });
+
+    RaceServices->WhenServiceReady<AWaypointManager>(this, [this](AWaypointManager* Manager)
+    {
+        if (bUseGraphNavigation && Graph)
+        {
+            return; // already following the graph
+        }
+
+        // Initialize waypoints
+        WaypointManager = Manager;
+        LinkedList = WaypointManager->WaypointList;
+        CurrentWaypoint = LinkedList ? Cast<AWaypoint>(LinkedList->GetFirst()) : nullptr;
+
+        if (!CurrentWaypoint)
+        {
+            UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: No valid first waypoint."));
+            return;
+        }
+
+        // Set up waypoint navigation
+        bUseGraphNavigation = false;
+        InitializeWaypointNavigation();
+
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Successfully initialized with waypoint navigation"));
+    });
+}
+
+void AAIRacerContoller::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
+
+    if (UWaypointArrivalSubsystem* Arrivals = GetWorld()->GetSubsystem<UWaypointArrivalSubsystem>())
+    {
+        Arrivals->RegisterRacer(InPawn, FOnWaypointArrival::CreateUObject(this, &AAIRacerContoller::OnWaypointReached));
+    }
+}
+
+void AAIRacerContoller::OnUnPossess()
+{
+    if (UWaypointArrivalSubsystem* Arrivals = GetWorld()->GetSubsystem<UWaypointArrivalSubsystem>())
+    {
+        Arrivals->UnregisterRacer(GetPawn());
+    }
+
+    Super::OnUnPossess();
 }
 
 void AAIRacerContoller::DetermineNavigationType()
@@ -153,7 +145,7 @@ void AAIRacerContoller::InitializeGraphNavigation()
 {
     if (!Graph)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Graph not set, falling back to waypoint navigation."));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerContoller: Graph not set, falling back to waypoint navigation."));
         bUseGraphNavigation = false;
         InitializeWaypointNavigation();
         return;
@@ -162,12 +154,15 @@ void AAIRacerContoller::InitializeGraphNavigation()
     // Find AdvancedRaceManager if not already set
     if (!AdvancedRaceManager)
     {
-        AdvancedRaceManager = Cast<AAdvancedRaceManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AAdvancedRaceManager::StaticClass()));
+        if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+        {
+            AdvancedRaceManager = RaceServices->GetService<AAdvancedRaceManager>();
+        }
     }
 
     if (!AdvancedRaceManager)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: AdvancedRaceManager not found, falling back to waypoint navigation."));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerContoller: AdvancedRaceManager not found, falling back to waypoint navigation."));
         bUseGraphNavigation = false;
         InitializeWaypointNavigation();
         return;
@@ -179,12 +174,15 @@ void AAIRacerContoller::InitializeGraphNavigation()
     if (CurrentWaypoint)
     {
         bUseGraphNavigation = true;
-        UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Graph navigation initialized with first waypoint: %s"), *CurrentWaypoint->GetName());
-        MoveToCurrentWaypoint();
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Graph navigation initialized with first waypoint: %s"), *CurrentWaypoint->GetName());
+        if (GetPawn()) // otherwise Tick starts the first move once the pawn is possessed
+        {
+            MoveToCurrentWaypoint();
+        }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Failed to get first waypoint from AdvancedRaceManager."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: Failed to get first waypoint from AdvancedRaceManager."));
     }
 }
 
@@ -192,12 +190,12 @@ void AAIRacerContoller::InitializeWaypointNavigation()
 {
     if (!WaypointManager || !LinkedList || !CurrentWaypoint)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Required components for waypoint navigation missing."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: Required components for waypoint navigation missing."));
         return;
     }
 
     bUseGraphNavigation = false;
-    UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Waypoint navigation initialized."));
+    UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Waypoint navigation initialized."));
 }
 
 void AAIRacerContoller::InitializeRacerPosition()
@@ -205,14 +203,14 @@ void AAIRacerContoller::InitializeRacerPosition()
     APawn* ControlledPawn = GetPawn();
     if (!ControlledPawn)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: No controlled pawn to initialize position."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: No controlled pawn to initialize position."));
         return;
     }
 
     UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
     if (!NavSys)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Navigation system not found!"));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: Navigation system not found!"));
         return;
     }
 
@@ -233,11 +231,11 @@ void AAIRacerContoller::InitializeRacerPosition()
         
         // Log the height adjustment for debugging
         float HeightDiff = CurrentLocation.Z - NavLocation.Location.Z;
-        UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Height adjusted by %f units"), HeightDiff);
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Height adjusted by %f units"), HeightDiff);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Could not find valid NavMesh position for racer."));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerContoller: Could not find valid NavMesh position for racer."));
     }
 }
 
@@ -245,13 +243,13 @@ void AAIRacerContoller::InitializeGraph(AGraph* InGraph)
 {
     if (!InGraph)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Attempted to initialize with null Graph."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: Attempted to initialize with null Graph."));
         return;
     }
 
     Graph = InGraph;
     bUseGraphNavigation = true;
-    UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Graph navigation initialized."));
+    UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Graph navigation initialized."));
 }
 
 void AAIRacerContoller::Tick(float DeltaTime)
@@ -262,7 +260,7 @@ void AAIRacerContoller::Tick(float DeltaTime)
     if (!bInitialized && GetPawn())
     {
         bInitialized = true;
-        UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Pawn possessed, initializing navigation."));
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerContoller: Pawn possessed, initializing navigation."));
         InitializeRacerPosition();
         GetWorld()->GetTimerManager().SetTimer(InitialMoveTimerHandle, this, &AAIRacerContoller::DelayedMoveToCurrentWaypoint, 0.5f, false);
     }
@@ -281,33 +279,37 @@ void AAIRacerContoller::OnWaypointReached(AActor* WaypointActor)
     if (!ReachedWaypoint) return;
 
     // Log waypoint progression
-    UE_LOG(LogTemp, Warning, TEXT("AI RACER %s - Reached Waypoint: %s"), *GetName(), *ReachedWaypoint->GetName());
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("AI RACER %s - Reached Waypoint: %s"), *GetName(), *ReachedWaypoint->GetName());
 
-    if (bUseGraphNavigation && Graph)
+    // The option list is only built when the verbosity is compiled in and enabled
+    if (UE_LOG_ACTIVE(LogGADERaceAI, Verbose))
     {
-        // Get next waypoint options from graph
-        TArray<AActor*> NextWaypoints = Graph->GetNeighbors(ReachedWaypoint);
-        
-        FString NextOptionsStr;
-        for (AActor* Next : NextWaypoints)
-        {
-            NextOptionsStr += FString::Printf(TEXT("%s, "), *Next->GetName());
-        }
-        
-        UE_LOG(LogTemp, Warning, TEXT("AI RACER %s - Next Possible Waypoints: %s"), *GetName(), *NextOptionsStr);
-        
-        // Log which waypoint was chosen
-        if (CurrentWaypoint)
+        if (bUseGraphNavigation && Graph)
         {
-            UE_LOG(LogTemp, Warning, TEXT("AI RACER %s - Selected Next Waypoint: %s"), *GetName(), *CurrentWaypoint->GetName());
+            // Get next waypoint options from graph
+            TArrayView<AActor* const> NextWaypoints = Graph->GetNeighborsView(ReachedWaypoint);
+
+            FString NextOptionsStr;
+            for (AActor* Next : NextWaypoints)
+            {
+                NextOptionsStr += FString::Printf(TEXT("%s, "), *Next->GetName());
+            }
+
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("AI RACER %s - Next Possible Waypoints: %s"), *GetName(), *NextOptionsStr);
+
+            // Log which waypoint was chosen
+            if (CurrentWaypoint)
+            {
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("AI RACER %s - Selected Next Waypoint: %s"), *GetName(), *CurrentWaypoint->GetName());
+            }
         }
-    }
-    else if (LinkedList)
-    {
-        AActor* NextWaypoint = LinkedList->GetNext(WaypointActor);
-        if (NextWaypoint)
+        else if (LinkedList)
         {
-            UE_LOG(LogTemp, Warning, TEXT("AI RACER %s - Next Waypoint: %s"), *GetName(), *NextWaypoint->GetName());
+            AActor* NextWaypoint = LinkedList->GetNext(WaypointActor);
+            if (NextWaypoint)
+            {
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("AI RACER %s - Next Waypoint: %s"), *GetName(), *NextWaypoint->GetName());
+            }
         }
     }
 
@@ -323,7 +325,7 @@ void AAIRacerContoller::OnWaypointReached(AActor* WaypointActor)
         {
             Racer->LapCount++;
             Racer->WaypointsPassed = 0;
-            UE_LOG(LogTemp, Warning, TEXT("LAP COMPLETED - Racer: %s, Lap: %d"), *Racer->GetName(), Racer->LapCount);
+            UE_LOG(LogGADERaceAI, Log, TEXT("LAP COMPLETED - Racer: %s, Lap: %d"), *Racer->GetName(), Racer->LapCount);
         }
 
         // Update GameState
@@ -337,34 +339,41 @@ void AAIRacerContoller::OnWaypointReached(AActor* WaypointActor)
     if (bUseGraphNavigation && Graph)
     {
         // Get available next waypoints from the graph
-        TArray<AActor*> Neighbors = Graph->GetNeighbors(ReachedWaypoint);
+        TArrayView<AActor* const> Neighbors = Graph->GetNeighborsView(ReachedWaypoint);
         
-        UE_LOG(LogTemp, Warning, TEXT("Available paths from %s:"), *ReachedWaypoint->GetName());
+        UE_LOG(LogGADERaceAI, Verbose, TEXT("Available paths from %s:"), *ReachedWaypoint->GetName());
         for (AActor* Neighbor : Neighbors)
         {
-            UE_LOG(LogTemp, Warning, TEXT("  - %s"), *Neighbor->GetName());
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("  - %s"), *Neighbor->GetName());
         }
         
         if (Neighbors.Num() > 0)
         {
-            // Randomly choose one of the available paths
-            int32 RandomIndex = FMath::RandRange(0, Neighbors.Num() - 1);
-            CurrentWaypoint = Cast<AWaypoint>(Neighbors[RandomIndex]);
+            // Take the branch with the lowest cost to the finish line, random only if none reaches it
+            AActor* BestNext = Graph->GetBestNextWaypoint(ReachedWaypoint);
+            if (!BestNext)
+            {
+                // Racer's own seeded stream keeps the choice reproducible for a given seed
+                AAIRacer* RacerPawn = Cast<AAIRacer>(GetPawn());
+                const int32 Choice = RacerPawn ? RacerPawn->DecisionStream.RandRange(0, Neighbors.Num() - 1) : FMath::RandRange(0, Neighbors.Num() - 1);
+                BestNext = Neighbors[Choice];
+            }
+            CurrentWaypoint = Cast<AWaypoint>(BestNext);
             
             if (CurrentWaypoint)
             {
-                UE_LOG(LogTemp, Warning, TEXT("Chosen path: %s -> %s"), 
+                UE_LOG(LogGADERaceAI, Verbose, TEXT("Chosen path: %s -> %s"), 
                     *ReachedWaypoint->GetName(), 
                     *CurrentWaypoint->GetName());
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("Failed to cast chosen waypoint."));
+                UE_LOG(LogGADERaceAI, Error, TEXT("Failed to cast chosen waypoint."));
             }
         }
         else
         {
-            UE_LOG(LogTemp, Error, TEXT("No neighboring waypoints found in graph for %s"), 
+            UE_LOG(LogGADERaceAI, Error, TEXT("No neighboring waypoints found in graph for %s"), 
                 *ReachedWaypoint->GetName());
         }
     }
@@ -374,7 +383,7 @@ void AAIRacerContoller::OnWaypointReached(AActor* WaypointActor)
         CurrentWaypoint = Cast<AWaypoint>(LinkedList->GetNext(ReachedWaypoint));
         if (CurrentWaypoint)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Using linked list navigation: %s -> %s"),
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("Using linked list navigation: %s -> %s"),
                 *ReachedWaypoint->GetName(),
                 *CurrentWaypoint->GetName());
         }
@@ -382,38 +391,44 @@ void AAIRacerContoller::OnWaypointReached(AActor* WaypointActor)
 
     if (CurrentWaypoint)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Moving to next waypoint: %s at %s"), 
+        UE_LOG(LogGADERaceAI, Verbose, TEXT("Moving to next waypoint: %s at %s"), 
             *CurrentWaypoint->GetName(),
             *CurrentWaypoint->GetActorLocation().ToString());
         MoveToCurrentWaypoint();
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to find next waypoint."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("Failed to find next waypoint."));
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("=== End Navigation Update ===\n"));
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("=== End Navigation Update ===\n"));
 }
 
 void AAIRacerContoller::MoveToCurrentWaypoint()
 {
     if (!CurrentWaypoint)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: CurrentWaypoint is null."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: CurrentWaypoint is null."));
         return;
     }
 
     APawn* ControlledPawn = GetPawn();
     if (!ControlledPawn)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: ControlledPawn is null."));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: ControlledPawn is null."));
         return;
     }
 
+    // Arrival is checked against the target even if the move request below fails
+    if (UWaypointArrivalSubsystem* Arrivals = GetWorld()->GetSubsystem<UWaypointArrivalSubsystem>())
+    {
+        Arrivals->SetTarget(ControlledPawn, CurrentWaypoint);
+    }
+
     UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
     if (!NavSys)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: Navigation system not found!"));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerContoller: Navigation system not found!"));
         return;
     }
 
@@ -426,15 +441,15 @@ void AAIRacerContoller::MoveToCurrentWaypoint()
     float NavMeshZ = NavLocation.Location.Z;
     float HeightDiff = FMath::Abs(RacerLocation.Z - NavMeshZ);
     
-    UE_LOG(LogTemp, Warning, TEXT("AIRacer %s Nav Mesh Status:"), *ControlledPawn->GetName());
-    UE_LOG(LogTemp, Warning, TEXT("  - On Nav Mesh: %s"), bIsOnNavMesh ? TEXT("Yes") : TEXT("No"));
-    UE_LOG(LogTemp, Warning, TEXT("  - Current Height: %.2f"), RacerLocation.Z);
-    UE_LOG(LogTemp, Warning, TEXT("  - Nav Mesh Height: %.2f"), NavMeshZ);
-    UE_LOG(LogTemp, Warning, TEXT("  - Height Difference: %.2f"), HeightDiff);
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("AIRacer %s Nav Mesh Status:"), *ControlledPawn->GetName());
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("  - On Nav Mesh: %s"), bIsOnNavMesh ? TEXT("Yes") : TEXT("No"));
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Current Height: %.2f"), RacerLocation.Z);
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Nav Mesh Height: %.2f"), NavMeshZ);
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Height Difference: %.2f"), HeightDiff);
     
     if (HeightDiff > 100.0f)
     {
-        UE_LOG(LogTemp, Error, TEXT("  - WARNING: Racer may be off nav mesh or too far above/below!"));
+        GADE_LOG_RATE_LIMITED(LogGADERaceAI, Warning, 1.0, TEXT("AIRacer %s may be off nav mesh or too far above/below it (%.2f)"), *ControlledPawn->GetName(), HeightDiff);
     }
 
     // If the Racer is on the NavMesh, set the location to the projected location
@@ -445,7 +460,7 @@ void AAIRacerContoller::MoveToCurrentWaypoint()
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Racer at %s is not on NavMesh"), *RacerLocation.ToString());
+        GADE_LOG_RATE_LIMITED(LogGADERaceAI, Warning, 1.0, TEXT("AIRacerContoller: Racer at %s is not on NavMesh"), *RacerLocation.ToString());
         return;
     }
 
@@ -458,13 +473,13 @@ void AAIRacerContoller::MoveToCurrentWaypoint()
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Waypoint at %s is not on NavMesh"), *WaypointLocation.ToString());
+        GADE_LOG_RATE_LIMITED(LogGADERaceAI, Warning, 1.0, TEXT("AIRacerContoller: Waypoint at %s is not on NavMesh"), *WaypointLocation.ToString());
         return;
     }
 
     // Log distance to waypoint
     float Distance = FVector::Distance(RacerLocation, WaypointLocation);
-    UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: Distance to waypoint %s: %f"), 
+    UE_LOG(LogGADERaceAI, Verbose, TEXT("AIRacerContoller: Distance to waypoint %s: %f"), 
         *CurrentWaypoint->GetName(), Distance);
 
     // Simple MoveToActor call - this is key for nav modifier avoidance
@@ -473,14 +488,14 @@ void AAIRacerContoller::MoveToCurrentWaypoint()
     switch (Result)
     {
     case EPathFollowingRequestResult::Failed:
-        UE_LOG(LogTemp, Error, TEXT("AIRacerContoller: MoveToActor failed for waypoint %s"), *CurrentWaypoint->GetName());
+        GADE_LOG_RATE_LIMITED(LogGADERaceAI, Error, 1.0, TEXT("AIRacerContoller: MoveToActor failed for waypoint %s"), *CurrentWaypoint->GetName());
         break;
     case EPathFollowingRequestResult::AlreadyAtGoal:
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerContoller: Already at waypoint %s"), *CurrentWaypoint->GetName());
+        UE_LOG(LogGADERaceAI, Verbose, TEXT("AIRacerContoller: Already at waypoint %s"), *CurrentWaypoint->GetName());
         OnWaypointReached(CurrentWaypoint);
         break;
     case EPathFollowingRequestResult::RequestSuccessful:
-        UE_LOG(LogTemp, Log, TEXT("AIRacerContoller: MoveToActor successful for waypoint %s"), *CurrentWaypoint->GetName());
+        UE_LOG(LogGADERaceAI, Verbose, TEXT("AIRacerContoller: MoveToActor successful for waypoint %s"), *CurrentWaypoint->GetName());
         break;
     }
 }
\ No newline at end of file
@@ -51,7 +51,7 @@ public:
     /** Called every frame to update AI behavior */
     virtual void Tick(float DeltaTime) override;
     
-    /** Handles logic when a waypoint is reached */
+    /** Handles logic when a waypoint is reached, called by UWaypointArrivalSubsystem */
     void OnWaypointReached(AActor* ReachedWaypoint);
 
     /** Initializes the navigation graph for advanced pathfinding */
@@ -63,6 +63,10 @@ public:
     AWaypoint* GetCurrentWaypoint() const { return CurrentWaypoint; }
 
 protected:
+    /** Registers the pawn for waypoint arrival checks */
+    virtual void OnPossess(APawn* InPawn) override;
+    virtual void OnUnPossess() override;
+
     /** Manager for linear waypoint navigation */
     UPROPERTY()
     AWaypointManager* WaypointManager;
@@ -89,9 +93,6 @@ protected:
 
     /** Timer for delayed initial movement */
     FTimerHandle InitialMoveTimerHandle;
-    
-    /** Timer for initialization checks */
-    FTimerHandle InitTimerHandle;
 
     /** Flag indicating if controller is fully initialized */
     bool bInitialized;
@@ -1,4 +1,5 @@
 #include "AIRacerFactory.h"
+#include "GADE_POE.h"
 #include "NavigationSystem.h"
 #include "EngineUtils.h" // For TActorIterator
 #include "Kismet/GameplayStatics.h"
@@ -29,7 +30,7 @@ AAIRacerFactory::AAIRacerFactory()
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Failed to find MyRacerSpawnPoint blueprint class"));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Failed to find MyRacerSpawnPoint blueprint class"));
     }
 }
 
@@ -47,14 +48,14 @@ void AAIRacerFactory::BeginPlay()
         if (SpawnPoint)
         {
             SpawnPoints.Add(SpawnPoint);
-            UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Found spawn point at %s"), *SpawnPoint->GetActorLocation().ToString());
+            UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Found spawn point at %s"), *SpawnPoint->GetActorLocation().ToString());
         }
     }
 
     // Check if any spawn points were found 
     if (SpawnPoints.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: No spawn points found in level! Cannot spawn racers."));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: No spawn points found in level! Cannot spawn racers."));
         return;
     }
 
@@ -66,7 +67,7 @@ AAIRacer* AAIRacerFactory::CreateRacer(UWorld* World, ERacerType RacerType, cons
 {
     if (!World) // Check if the world is valid 
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Invalid World"));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Invalid World"));
         return nullptr;
     }
 
@@ -83,13 +84,13 @@ AAIRacer* AAIRacerFactory::CreateRacer(UWorld* World, ERacerType RacerType, cons
         SelectedClass = SlowRacerClass;
         break;
     default:
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Invalid RacerType"));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Invalid RacerType"));
         return nullptr;
     }
 
 	if (!SelectedClass) // Check if the selected class is valid
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: No class set for RacerType %s"), *UEnum::GetValueAsString(RacerType));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: No class set for RacerType %s"), *UEnum::GetValueAsString(RacerType));
         return nullptr;
     }
 
@@ -103,16 +104,16 @@ AAIRacer* AAIRacerFactory::CreateRacer(UWorld* World, ERacerType RacerType, cons
         if (NavSystem->ProjectPointToNavigation(SpawnLocation, NavLocation, QueryExtent))
         {
             FinalSpawnLocation = NavLocation.Location + FVector(0, 0, 50.0f); // Reduced height offset
-            UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Successfully projected spawn location to nav mesh at %s"), *FinalSpawnLocation.ToString());
+            UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Successfully projected spawn location to nav mesh at %s"), *FinalSpawnLocation.ToString());
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Failed to project spawn location %s to NavMesh"), *SpawnLocation.ToString());
+            UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Failed to project spawn location %s to NavMesh"), *SpawnLocation.ToString());
         }
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: No NavSystem available"));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: No NavSystem available"));
     }
 
     FActorSpawnParameters SpawnParams; // Variable to store the spawn parameters 
@@ -123,7 +124,7 @@ AAIRacer* AAIRacerFactory::CreateRacer(UWorld* World, ERacerType RacerType, cons
         NewRacer->RacerType = RacerType;
 		NewRacer->SetupRacerAttributes(); // Call the setup function to initialize the racer
         SpawnedRacers.Add(NewRacer);
-        UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Spawned %s at %s"), *UEnum::GetValueAsString(RacerType), *FinalSpawnLocation.ToString());
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Spawned %s at %s"), *UEnum::GetValueAsString(RacerType), *FinalSpawnLocation.ToString());
     }
 
     return NewRacer;
@@ -133,7 +134,7 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
 {
     if (!World)
     {
-        UE_LOG(LogTemp, Error, TEXT("AIRacerFactory: World is null"));
+        UE_LOG(LogGADERaceAI, Error, TEXT("AIRacerFactory: World is null"));
         return;
     }
 
@@ -154,7 +155,7 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
             if (!UniqueSpawnPoints.Contains(Location)) // Check if the location is already in the map
             {
                 UniqueSpawnPoints.Add(Location, SpawnPoint); // Add the spawn point to the map 
-                UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Found spawn point at %s"), *Location.ToString()); 
+                UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Found spawn point at %s"), *Location.ToString()); 
             }
         }
     }
@@ -169,14 +170,14 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
 
     if (SpawnPoints.Num() == 0) // Check if any spawn points were found
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: No spawn points found"));
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: No spawn points found"));
         return;
     }
 
     float TotalProb = InFastChance + InMediumChance + InSlowChance;
     if (TotalProb <= 0.0f) // Check if the probabilities are valid 
     {
-        UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Invalid probabilities, using default")); 
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Invalid probabilities, using default")); 
         InFastChance = 0.33f;
         InMediumChance = 0.33f;
         InSlowChance = 0.34f;
@@ -188,11 +189,11 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
 
     // Calculate the number of racers to spawn
     int32 RacersToSpawn = FMath::Min(InMaxRacers, SpawnPoints.Num());
-    UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Attempting to spawn %d racers"), RacersToSpawn);
+    UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Attempting to spawn %d racers"), RacersToSpawn);
     for (int32 i = 0; i < RacersToSpawn; i++)
     {
         FVector SpawnLocation = SpawnPoints[i]->GetActorLocation();
-        UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Processing spawn location %s"), *SpawnLocation.ToString());
+        UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Processing spawn location %s"), *SpawnLocation.ToString());
 
         // Validate spawn point height with a longer trace
         FHitResult GroundHit;
@@ -211,7 +212,7 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: No ground found below spawn point %s"), *SpawnLocation.ToString());
+            UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: No ground found below spawn point %s"), *SpawnLocation.ToString());
             continue;
         }
 
@@ -226,7 +227,7 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
 
         if (bHasOverlap)
         {
-            UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Spawn location %s is blocked"), *SpawnLocation.ToString());
+            UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Spawn location %s is blocked"), *SpawnLocation.ToString());
             continue;
         }
 
@@ -258,7 +259,7 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
 
         if (!RacerClass)
         {
-            UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: RacerClass is null for type %s"), *UEnum::GetValueAsString(RacerType));
+            UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: RacerClass is null for type %s"), *UEnum::GetValueAsString(RacerType));
             continue;
         }
         //spawn the racer and AI controller 
@@ -266,7 +267,7 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
 
         if (NewRacer)
         {
-            UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Successfully spawned racer at %s"), *SpawnLocation.ToString());
+            UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Successfully spawned racer at %s"), *SpawnLocation.ToString());
 			NewRacer->RacerType = RacerType; // Set the racer type
             NewRacer->SetupRacerAttributes(); // Set the racer attributes
 
@@ -277,19 +278,19 @@ void AAIRacerFactory::SpawnRacers(UWorld* World, int32 InMaxRacers, float InFast
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Failed to spawn AIController for racer at %s"), *SpawnLocation.ToString());
+                UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Failed to spawn AIController for racer at %s"), *SpawnLocation.ToString());
             }
 
             SpawnedRacers.Add(NewRacer);
-            UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Spawned %s at %s"), *UEnum::GetValueAsString(RacerType), *NewRacer->GetActorLocation().ToString());
+            UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Spawned %s at %s"), *UEnum::GetValueAsString(RacerType), *NewRacer->GetActorLocation().ToString());
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("AIRacerFactory: Failed to spawn %s at %s"), *UEnum::GetValueAsString(RacerType), *SpawnLocation.ToString());
+            UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerFactory: Failed to spawn %s at %s"), *UEnum::GetValueAsString(RacerType), *SpawnLocation.ToString());
         }
     }
 
-    UE_LOG(LogTemp, Log, TEXT("AIRacerFactory: Successfully spawned %d racers"), SpawnedRacers.Num());
+    UE_LOG(LogGADERaceAI, Log, TEXT("AIRacerFactory: Successfully spawned %d racers"), SpawnedRacers.Num());
 }
 
 void AAIRacerFactory::SpawnRacersWithDefaults(UWorld* World) // Function to spawn racers with default values
@@ -0,0 +1,291 @@
+#include "AIRacerSimulationManager.h"
+#include "GADE_POE.h"
+#include "AIRacer.h"
+#include "AIRacerContoller.h"
+#include "Waypoint.h"
+#include "RacerProximitySubsystem.h"
+#include "RaceWorldSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+// Overrides for the manager's settings, which can only be edited on a placed manager. The defaults keep them.
+static TAutoConsoleVariable<int32> CVarAIRacerParallelSimulation(
+    TEXT("AIRacer.ParallelSimulation"),
+    -1,
+    TEXT("Simulate AI racers on worker threads. -1: use the manager's setting, 0: game thread only, 1: parallel"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAIRacerParallelBatchSize(
+    TEXT("AIRacer.ParallelBatchSize"),
+    0,
+    TEXT("Racers per worker task in the parallel simulation. 0: use the manager's setting"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAIRacerRandomSeed(
+    TEXT("AIRacer.RandomSeed"),
+    -1,
+    TEXT("Seed for AI racer decisions, applied to racers that register after it is set. -1: use the manager's setting"),
+    ECVF_Default);
+
+AAIRacerSimulationManager::AAIRacerSimulationManager()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    Proximity = nullptr;
+}
+
+AAIRacerSimulationManager* AAIRacerSimulationManager::Get(UWorld* World)
+{
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    URaceWorldSubsystem* RaceServices = World->GetSubsystem<URaceWorldSubsystem>();
+    if (!RaceServices)
+    {
+        return nullptr;
+    }
+
+    AAIRacerSimulationManager* Manager = RaceServices->GetService<AAIRacerSimulationManager>();
+    if (!Manager)
+    {
+        // Registers itself in PostInitializeComponents, before SpawnActor returns
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        Manager = World->SpawnActor<AAIRacerSimulationManager>(AAIRacerSimulationManager::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+    }
+    return Manager;
+}
+
+void AAIRacerSimulationManager::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    UWorld* World = GetWorld();
+    URaceWorldSubsystem* RaceServices = World && World->IsGameWorld() ? World->GetSubsystem<URaceWorldSubsystem>() : nullptr;
+    if (RaceServices && !RaceServices->GetService<AAIRacerSimulationManager>())
+    {
+        RaceServices->RegisterService(this);
+    }
+}
+
+void AAIRacerSimulationManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->UnregisterService(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void AAIRacerSimulationManager::RegisterRacer(AAIRacer* Racer)
+{
+    if (!Racer || Racers.Contains(Racer))
+    {
+        return;
+    }
+
+    UCharacterMovementComponent* Movement = Racer->GetCharacterMovement();
+    if (!Movement)
+    {
+        UE_LOG(LogGADERaceAI, Warning, TEXT("AIRacerSimulationManager: %s has no movement component, leaving it to tick itself."), *Racer->GetName());
+        return;
+    }
+
+    if (!Proximity)
+    {
+        Proximity = GetWorld()->GetSubsystem<URacerProximitySubsystem>();
+    }
+
+    Racers.Add(Racer);
+    Movements.Add(Movement);
+    Positions.AddZeroed();
+    Forwards.AddZeroed();
+    Targets.AddZeroed();
+    HasTarget.Add(0);
+    Speeds.Add(0.0f);
+    MaxSpeeds.Add(Racer->MaxSpeed);
+    MaxWalkSpeeds.Add(Movement->MaxWalkSpeed);
+    BrakingDistances.Add(Racer->BrakingDistance);
+    CorneringMultipliers.Add(Racer->CorneringSpeedMultiplier);
+    MinCorneringSpeeds.Add(Racer->MinCorneringSpeed);
+    MaxCorneringAngles.Add(Racer->MaxCorneringAngle);
+    AccelerationRates.Add(Racer->AccelerationRate);
+    BrakingRates.Add(Racer->BrakingRate);
+    Distances.Add(0.0f);
+    CornerAngles.Add(0.0f);
+
+    // Seeded per racer rather than shared, so decisions don't depend on which racer asks first
+    const int32 SeedOverride = CVarAIRacerRandomSeed.GetValueOnGameThread();
+    const int32 Seed = SeedOverride >= 0 ? SeedOverride : RandomSeed;
+    Racer->DecisionStream.Initialize(HashCombine(GetTypeHash(Seed), GetTypeHash(NumRegistered++)));
+
+    // The manager drives this racer from now on
+    Racer->SetActorTickEnabled(false);
+}
+
+void AAIRacerSimulationManager::UnregisterRacer(AAIRacer* Racer)
+{
+    const int32 Index = Racers.Find(Racer);
+    if (Index != INDEX_NONE)
+    {
+        RemoveRacerAt(Index);
+    }
+}
+
+void AAIRacerSimulationManager::RemoveRacerAt(int32 Index)
+{
+    Racers.RemoveAtSwap(Index);
+    Movements.RemoveAtSwap(Index);
+    Positions.RemoveAtSwap(Index);
+    Forwards.RemoveAtSwap(Index);
+    Targets.RemoveAtSwap(Index);
+    HasTarget.RemoveAtSwap(Index);
+    Speeds.RemoveAtSwap(Index);
+    MaxSpeeds.RemoveAtSwap(Index);
+    MaxWalkSpeeds.RemoveAtSwap(Index);
+    BrakingDistances.RemoveAtSwap(Index);
+    CorneringMultipliers.RemoveAtSwap(Index);
+    MinCorneringSpeeds.RemoveAtSwap(Index);
+    MaxCorneringAngles.RemoveAtSwap(Index);
+    AccelerationRates.RemoveAtSwap(Index);
+    BrakingRates.RemoveAtSwap(Index);
+    Distances.RemoveAtSwap(Index);
+    CornerAngles.RemoveAtSwap(Index);
+}
+
+void AAIRacerSimulationManager::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Drop racers destroyed without going through EndPlay
+    for (int32 i = Racers.Num() - 1; i >= 0; i--)
+    {
+        if (!IsValid(Racers[i]) || !IsValid(Movements[i]))
+        {
+            RemoveRacerAt(i);
+        }
+    }
+
+    if (Racers.Num() == 0)
+    {
+        return;
+    }
+
+    GatherState();
+
+    const int32 NumRacers = Racers.Num();
+    const int32 ParallelOverride = CVarAIRacerParallelSimulation.GetValueOnGameThread();
+    const bool bParallel = ParallelOverride >= 0 ? ParallelOverride > 0 : bParallelSimulation;
+    const int32 BatchSizeOverride = CVarAIRacerParallelBatchSize.GetValueOnGameThread();
+    const int32 BatchSize = FMath::Max(BatchSizeOverride > 0 ? BatchSizeOverride : ParallelBatchSize, 1);
+    if (bParallel && NumRacers > BatchSize)
+    {
+        // Every racer reads and writes only its own slots, so how the work is split can't change the results
+        const int32 NumBatches = FMath::DivideAndRoundUp(NumRacers, BatchSize);
+        ParallelFor(NumBatches, [this, BatchSize, NumRacers, DeltaTime](int32 Batch)
+        {
+            const int32 Begin = Batch * BatchSize;
+            Simulate(Begin, FMath::Min(Begin + BatchSize, NumRacers), DeltaTime);
+        });
+    }
+    else
+    {
+        Simulate(0, NumRacers, DeltaTime);
+    }
+
+    // Actor and component writes stay on the game thread
+    ApplyResults(DeltaTime);
+
+    NavCheckTimer += DeltaTime;
+    if (NavCheckTimer >= NavCheckInterval)
+    {
+        NavCheckTimer = 0.0f;
+        for (AAIRacer* Racer : Racers)
+        {
+            Racer->UpdateNavMeshHeight(DeltaTime);
+        }
+    }
+}
+
+void AAIRacerSimulationManager::GatherState()
+{
+    for (int32 i = 0; i < Racers.Num(); i++)
+    {
+        const AAIRacer* Racer = Racers[i];
+        const AAIRacerContoller* Controller = Cast<AAIRacerContoller>(Racer->GetController());
+        const AWaypoint* Waypoint = Controller ? Controller->GetCurrentWaypoint() : nullptr;
+
+        HasTarget[i] = Waypoint != nullptr;
+        if (Waypoint)
+        {
+            Targets[i] = Waypoint->GetActorLocation();
+        }
+        Positions[i] = Racer->GetActorLocation();
+        Forwards[i] = Racer->GetActorForwardVector();
+        Speeds[i] = Movements[i]->Velocity.Size();
+        MaxSpeeds[i] = Racer->MaxSpeed;
+        MaxWalkSpeeds[i] = Movements[i]->MaxWalkSpeed;
+    }
+}
+
+void AAIRacerSimulationManager::Simulate(int32 Begin, int32 End, float DeltaTime)
+{
+    // Geometry pass: distance and turn angle to each racer's waypoint
+    for (int32 i = Begin; i < End; i++)
+    {
+        const FVector ToWaypoint = Targets[i] - Positions[i];
+        const float Distance = ToWaypoint.Size();
+        const float CosAngle = FMath::Clamp(static_cast<float>(FVector::DotProduct(Forwards[i], ToWaypoint.GetSafeNormal())), -1.0f, 1.0f);
+        Distances[i] = Distance;
+        CornerAngles[i] = FMath::RadiansToDegrees(FMath::Acos(CosAngle));
+    }
+
+    // Speed pass: plain float math over the arrays, no actor access
+    for (int32 i = Begin; i < End; i++)
+    {
+        if (!HasTarget[i])
+        {
+            continue;
+        }
+
+        const float DesiredSpeed = ComputeDesiredSpeed(Distances[i], CornerAngles[i], MaxSpeeds[i], MaxCorneringAngles[i],
+            CorneringMultipliers[i], BrakingDistances[i], MinCorneringSpeeds[i]);
+
+        if (Speeds[i] < DesiredSpeed)
+        {
+            // Speed up
+            MaxWalkSpeeds[i] = FMath::Min(MaxWalkSpeeds[i] + AccelerationRates[i] * DeltaTime, MaxSpeeds[i]);
+        }
+        else if (Speeds[i] > DesiredSpeed)
+        {
+            // Slow down
+            MaxWalkSpeeds[i] = FMath::Max(MaxWalkSpeeds[i] - BrakingRates[i] * DeltaTime, MinCorneringSpeeds[i]);
+        }
+    }
+}
+
+void AAIRacerSimulationManager::ApplyResults(float DeltaTime)
+{
+    for (int32 i = 0; i < Racers.Num(); i++)
+    {
+        AAIRacer* Racer = Racers[i];
+        Racer->CurrentSpeed = Speeds[i];
+        if (!HasTarget[i])
+        {
+            continue;
+        }
+
+        UCharacterMovementComponent* Movement = Movements[i];
+        Movement->MaxWalkSpeed = MaxWalkSpeeds[i];
+
+        // Handle collision avoidance
+        if (Movement->bUseRVOAvoidance && Proximity
+            && Proximity->AnyWithinRadius(Positions[i], Movement->AvoidanceConsiderationRadius, Racer))
+        {
+            // Increase avoidance when near others
+            Movement->AvoidanceWeight = FMath::Min(Movement->AvoidanceWeight + DeltaTime, 1.0f);
+        }
+    }
+}
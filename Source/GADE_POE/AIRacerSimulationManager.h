@@ -0,0 +1,128 @@
+/**
+ AIRacerSimulationManager
+
+ Runs the per-frame racing behaviour of every AI racer from one tick.
+ Racer state is gathered into contiguous arrays, the speed math runs as flat loops
+ over those arrays, and the results are written back to each CharacterMovement.
+ Racers register themselves on BeginPlay and stop ticking on their own.
+ The manager is a race service in URaceWorldSubsystem, and the AIRacer.* console
+ variables override its settings, since it is usually spawned rather than placed.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AIRacerSimulationManager.generated.h"
+
+class AAIRacer;
+class UCharacterMovementComponent;
+class URacerProximitySubsystem;
+
+UCLASS()
+class GADE_POE_API AAIRacerSimulationManager : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AAIRacerSimulationManager();
+
+    /** The manager registered with World's race services, spawning one the first time a racer asks */
+    static AAIRacerSimulationManager* Get(UWorld* World);
+
+    void RegisterRacer(AAIRacer* Racer);
+    void UnregisterRacer(AAIRacer* Racer);
+
+    virtual void Tick(float DeltaTime) override;
+
+protected:
+    // Registers a placed manager before any racer's BeginPlay can spawn a second one
+    virtual void PostInitializeComponents() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+    /** Speed a racer should aim for given the distance to and turn angle of its next waypoint */
+    static FORCEINLINE float ComputeDesiredSpeed(float DistanceToCorner, float CornerAngle, float MaxSpeed, float MaxCorneringAngle,
+        float CorneringSpeedMultiplier, float BrakingDistance, float MinCorneringSpeed)
+    {
+        float DesiredSpeed = MaxSpeed;
+
+        // Reduce speed for sharp turns
+        if (CornerAngle > 0.0f)
+        {
+            const float AngleRatio = FMath::Clamp(CornerAngle / MaxCorneringAngle, 0.0f, 1.0f);
+            DesiredSpeed *= FMath::Lerp(1.0f, CorneringSpeedMultiplier, AngleRatio);
+        }
+
+        // Brake when approaching corner
+        if (DistanceToCorner < BrakingDistance)
+        {
+            const float DistanceRatio = FMath::Clamp(DistanceToCorner / BrakingDistance, 0.0f, 1.0f);
+            DesiredSpeed = FMath::Lerp(MinCorneringSpeed, DesiredSpeed, DistanceRatio);
+        }
+
+        return FMath::Max(DesiredSpeed, MinCorneringSpeed);
+    }
+
+    /** Seconds between nav mesh height checks for every racer */
+    UPROPERTY(EditAnywhere, Category = "Simulation")
+    float NavCheckInterval = 1.0f;
+
+    /**
+     * Spread the steering and speed math over worker threads. Results match the serial path exactly.
+     * AIRacer.ParallelSimulation 0 or 1 overrides it.
+     */
+    UPROPERTY(EditAnywhere, Category = "Simulation")
+    bool bParallelSimulation = true;
+
+    /** Racers per worker task, below this many racers the parallel path isn't worth the dispatch. AIRacer.ParallelBatchSize overrides it. */
+    UPROPERTY(EditAnywhere, Category = "Simulation", meta = (ClampMin = "1"))
+    int32 ParallelBatchSize = 32;
+
+    /**
+     * Seed for every racer's decision stream, so branch choices replay the same for the same seed.
+     * AIRacer.RandomSeed overrides it for racers that register after it is set.
+     */
+    UPROPERTY(EditAnywhere, Category = "Simulation")
+    int32 RandomSeed = 1337;
+
+private:
+    UPROPERTY()
+    TArray<AAIRacer*> Racers;
+
+    UPROPERTY()
+    TArray<UCharacterMovementComponent*> Movements;
+
+    UPROPERTY()
+    URacerProximitySubsystem* Proximity;
+
+    // Gathered from the actors every frame
+    TArray<FVector> Positions;
+    TArray<FVector> Forwards;
+    TArray<FVector> Targets;
+    TArray<uint8> HasTarget; // 0 while the controller has no waypoint, the racer is left alone then
+    TArray<float> Speeds;
+    TArray<float> MaxSpeeds; // pickups change this at runtime
+    TArray<float> MaxWalkSpeeds; // read, updated and written back
+
+    // Tuning, cached when the racer registers
+    TArray<float> BrakingDistances;
+    TArray<float> CorneringMultipliers;
+    TArray<float> MinCorneringSpeeds;
+    TArray<float> MaxCorneringAngles;
+    TArray<float> AccelerationRates;
+    TArray<float> BrakingRates;
+
+    // Per-frame scratch
+    TArray<float> Distances;
+    TArray<float> CornerAngles;
+
+    float NavCheckTimer = 0.0f;
+    int32 NumRegistered = 0; // registrations so far, gives each racer its own stream seed
+
+    void GatherState();
+    void Simulate(int32 Begin, int32 End, float DeltaTime); // only touches the arrays above
+    void ApplyResults(float DeltaTime);
+    void RemoveRacerAt(int32 Index);
+};
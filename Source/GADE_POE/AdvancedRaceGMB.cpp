@@ -9,12 +9,22 @@ AAdvancedRaceGMB::AAdvancedRaceGMB()
 {
     // Set default values
     PrimaryActorTick.bCanEverTick = false;
+
+    // Race sounds plus the pause menu's
+    SoundPreloadSet.BuiltinSounds = { ESFXSound::Waypoint, ESFXSound::Lap, ESFXSound::Crash, ESFXSound::Engine, ESFXSound::BackgroundMusic,
+        ESFXSound::End, ESFXSound::ButtonClick, ESFXSound::ButtonHover, ESFXSound::MenuOpen, ESFXSound::MenuClose };
 }
 
 void AAdvancedRaceGMB::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Stream this mode's sounds in while the level starts
+    if (ASFXManager* SFXManager = ASFXManager::GetInstance(GetWorld()))
+    {
+        SFXManager->PreloadSounds(SoundPreloadSet);
+    }
+
     // Initialize all race components
     InitializeRaceComponents();
 
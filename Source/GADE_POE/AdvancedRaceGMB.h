@@ -7,6 +7,7 @@
 #include "AdvancedRaceManager.h"
 #include "Graph.h"
 #include "Blueprint/UserWidget.h"
+#include "SFXManager.h"
 #include "AdvancedRaceGMB.generated.h"
 
 /**
@@ -38,6 +39,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
 	TSubclassOf<UUserWidget> RaceEndWidgetClass;
 
+	// Sounds streamed in when the level starts, so their first play doesn't wait on a load
+	UPROPERTY(EditDefaultsOnly, Category = "Audio")
+	FSFXPreloadSet SoundPreloadSet;
+
 protected:
 	// Reference to the race manager
 	UPROPERTY()
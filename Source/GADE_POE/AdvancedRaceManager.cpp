@@ -1,8 +1,10 @@
 #include "AdvancedRaceManager.h"
-#include "Kismet/GameplayStatics.h"
+#include "GADE_POE.h"
 #include "Waypoint.h"
 #include "Graph.h"
 #include "BiginnerRaceGameState.h"
+#include "WaypointRegistrySubsystem.h"
+#include "RaceWorldSubsystem.h"
 
 // Sets default values 
 AAdvancedRaceManager::AAdvancedRaceManager()
@@ -11,8 +13,9 @@ AAdvancedRaceManager::AAdvancedRaceManager()
     Graph = nullptr;
     RaceTrack = nullptr;
     GameState = nullptr;
+    TrackTopology = nullptr;
     TotalWaypoints = 0;
-    UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager %s: Constructor called."), *GetName());
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager %s: Constructor called."), *GetName());
 }
 
 void AAdvancedRaceManager::BeginPlay()
@@ -22,22 +25,62 @@ void AAdvancedRaceManager::BeginPlay()
     GameState = Cast<ABeginnerRaceGameState>(GetWorld()->GetGameState());
     if (!GameState) // Check if the game state is valid
     {
-        UE_LOG(LogTemp, Error, TEXT("AdvancedRaceManager %s: Failed to find BeginnerRaceGameState."), *GetName());
+        UE_LOG(LogGADERace, Error, TEXT("AdvancedRaceManager %s: Failed to find BeginnerRaceGameState."), *GetName());
     }
 
     if (!Graph)
     {
 		Graph = NewObject<AGraph>(this); // Create a new instance of AGraph if it is null
-        UE_LOG(LogTemp, Warning, TEXT("AdvancedRaceManager %s: Graph was null, created new instance."), *GetName());
+        UE_LOG(LogGADERace, Warning, TEXT("AdvancedRaceManager %s: Graph was null, created new instance."), *GetName());
+    }
+
+    if (UWaypointRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UWaypointRegistrySubsystem>())
+    {
+        WaypointUnregisteredHandle = Registry->OnWaypointUnregistered.AddUObject(this, &AAdvancedRaceManager::HandleWaypointUnregistered);
     }
 
     CollectWaypoints();
     PopulateGraph();
 
     TotalWaypoints = Waypoints.Num();
-    UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager %s: Set TotalWaypoints to %d."), *GetName(), TotalWaypoints);
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager %s: Set TotalWaypoints to %d."), *GetName(), TotalWaypoints);
+
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager %s: BeginPlay completed, Graph populated with %d waypoints."), *GetName(), Waypoints.Num());
+
+    RegisterServices();
+}
+
+void AAdvancedRaceManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWaypointRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UWaypointRegistrySubsystem>())
+    {
+        Registry->OnWaypointUnregistered.Remove(WaypointUnregisteredHandle);
+    }
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->UnregisterService(this);
+        RaceServices->UnregisterService(Graph);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void AAdvancedRaceManager::RegisterServices()
+{
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        // Graph first, whoever waits on the manager reads the graph from it
+        RaceServices->RegisterService(Graph);
+        RaceServices->RegisterService(this);
+    }
+}
 
-    UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager %s: BeginPlay completed, Graph populated with %d waypoints."), *GetName(), Waypoints.Num());
+void AAdvancedRaceManager::HandleWaypointUnregistered(int32 WaypointId, AWaypoint* Waypoint)
+{
+    if (Graph)
+    {
+        Graph->RemoveNode(Waypoint);
+        UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager: Removed waypoint %s (ID %d) from the graph."), *Waypoint->GetName(), WaypointId);
+    }
 }
 
 void AAdvancedRaceManager::InitializeTrack(AActor* RaceTrackActor, AGraph* InGraph)
@@ -48,36 +91,80 @@ void AAdvancedRaceManager::InitializeTrack(AActor* RaceTrackActor, AGraph* InGra
     if (!Graph)
     {
         Graph = NewObject<AGraph>(this);
-        UE_LOG(LogTemp, Warning, TEXT("AdvancedRaceManager %s: InitializeTrack received null Graph, created new instance."), *GetName());
+        UE_LOG(LogGADERace, Warning, TEXT("AdvancedRaceManager %s: InitializeTrack received null Graph, created new instance."), *GetName());
     }
 
     CollectWaypoints();
     PopulateGraph();
 
     TotalWaypoints = Waypoints.Num();
-    UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager %s: Set TotalWaypoints to %d."), *GetName(), TotalWaypoints);
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager %s: Set TotalWaypoints to %d."), *GetName(), TotalWaypoints);
+
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager %s: Track initialized with %d waypoints."), *GetName(), Waypoints.Num());
 
-    UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager %s: Track initialized with %d waypoints."), *GetName(), Waypoints.Num());
+    RegisterServices();
 }
  
 void AAdvancedRaceManager::CollectWaypoints() // Collect waypoints from the world and add them to the graph 
 {
     Waypoints.Empty();
-    TArray<AActor*> FoundActors;
     // Use TSubclassOf<AWaypoint> consistently
     TSubclassOf<AWaypoint> ClassToFind = WaypointClass.Get() ? WaypointClass : TSubclassOf<AWaypoint>(AWaypoint::StaticClass());
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ClassToFind, FoundActors);
 
-    for (AActor* Actor : FoundActors)
+    // Every waypoint registered itself before BeginPlay, in level order, so there is no actor search
+    UWaypointRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UWaypointRegistrySubsystem>();
+    if (Registry)
+    {
+        for (AWaypoint* Waypoint : Registry->GetWaypoints())
+        {
+            if (Waypoint && Waypoint->IsA(ClassToFind))
+            {
+                Waypoints.Add(Waypoint);
+            }
+        }
+    }
+
+    // With a topology asset the track order comes from the asset, not from actor iteration order
+    if (TrackTopology)
+    {
+        TMap<FName, AWaypoint*> ById;
+        ById.Reserve(Waypoints.Num());
+        for (AWaypoint* Waypoint : Waypoints)
+        {
+            ById.Add(Waypoint->GetWaypointId(), Waypoint);
+        }
+
+        Waypoints.Reset();
+        int32 Missing = 0;
+        for (const FName& Id : TrackTopology->Waypoints)
+        {
+            if (AWaypoint** Found = ById.Find(Id))
+            {
+                Waypoints.Add(*Found);
+            }
+            else
+            {
+                Missing++;
+            }
+        }
+        if (Missing > 0)
+        {
+            UE_LOG(LogGADERace, Error, TEXT("AdvancedRaceManager: %d waypoint IDs in %s have no matching actor in the level."), Missing, *TrackTopology->GetName());
+        }
+    }
+
+    TArray<FVector> Locations;
+    Locations.Reserve(Waypoints.Num());
+    TrackIndexById.Init(INDEX_NONE, Registry ? Registry->GetNumIds() : 0);
+    for (int32 i = 0; i < Waypoints.Num(); i++)
     {
-        AWaypoint* Waypoint = Cast<AWaypoint>(Actor);
-        if (Waypoint && Waypoint->IsValidLowLevel())
+        Locations.Add(Waypoints[i]->GetActorLocation());
+        if (TrackIndexById.IsValidIndex(Waypoints[i]->GetRegistryId()))
         {
-            Waypoints.Add(Waypoint);
-            Graph->AddNode(Waypoint);
-            UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager: Collected and added waypoint %s at %s to graph"), *Waypoint->GetName(), *Waypoint->GetActorLocation().ToString());
+            TrackIndexById[Waypoints[i]->GetRegistryId()] = i;
         }
     }
+    SegmentTable.Build(Locations);
 
     // Update TotalWaypoints
     TotalWaypoints = Waypoints.Num();
@@ -91,96 +178,112 @@ void AAdvancedRaceManager::CollectWaypoints() // Collect waypoints from the worl
     if (GameState)
     {
         GameState->TotalWaypoints = TotalWaypoints;
-        UE_LOG(LogTemp, Warning, TEXT("AdvancedRaceManager: Updated GameState TotalWaypoints to %d"), TotalWaypoints);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("AdvancedRaceManager: GameState is null, cannot update TotalWaypoints"));
+        UE_LOG(LogGADERace, Error, TEXT("AdvancedRaceManager: GameState is null, cannot update TotalWaypoints"));
     }
 
-    UE_LOG(LogTemp, Log, TEXT("AdvancedRaceManager: Collected %d waypoints."), Waypoints.Num());
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager: Collected %d waypoints."), Waypoints.Num());
 }
 
 void AAdvancedRaceManager::PopulateGraph()
 {
     if (!Graph || Waypoints.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("AdvancedRaceManager: Cannot populate graph, Graph is null or no waypoints."));
+        UE_LOG(LogGADERace, Error, TEXT("AdvancedRaceManager: Cannot populate graph, Graph is null or no waypoints."));
         return;
     }
-     
-    UE_LOG(LogTemp, Warning, TEXT("=== Advanced Race Track Waypoint Order ==="));
-    UE_LOG(LogTemp, Warning, TEXT("Track Layout:"));
-    UE_LOG(LogTemp, Warning, TEXT("Main Path: 0->1->2->3"));
-    UE_LOG(LogTemp, Warning, TEXT("Branch 1: 3->[4 or 5]->6->7->8"));
-    UE_LOG(LogTemp, Warning, TEXT("Branch 2: 8->[9 or 10]->11->0 (loop)"));
-    UE_LOG(LogTemp, Warning, TEXT(""));
-    UE_LOG(LogTemp, Warning, TEXT("Waypoint Positions:"));
-    
-    // Log all waypoint positions
-    for (int32 i = 0; i < Waypoints.Num(); i++)
+
+    TArray<FGraphEdgeInit> Edges;
+    if (TrackTopology)
     {
-        if (Waypoints[i])
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Waypoint %d: %s at location %s"), 
-                i, 
-                *Waypoints[i]->GetName(), 
-                *Waypoints[i]->GetActorLocation().ToString());
-        }
+        GatherTopologyEdges(Edges);
     }
-    UE_LOG(LogTemp, Warning, TEXT(""));
-
-    // Branch 1: 3->4, 3->5, 4->6, 5->6
-    if (Waypoints.Num() > 6)
+    else
     {
-        Graph->AddEdge(Waypoints[2], Waypoints[3]); // 3->4
-        Graph->AddEdge(Waypoints[2], Waypoints[4]); // 3->5
-        Graph->AddEdge(Waypoints[3], Waypoints[5]); // 4->6
-        Graph->AddEdge(Waypoints[4], Waypoints[5]); // 5->6
-        UE_LOG(LogTemp, Warning, TEXT("Branch 1 Connections:"));
-        UE_LOG(LogTemp, Warning, TEXT("  3->4: %s -> %s"), *Waypoints[2]->GetName(), *Waypoints[3]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  3->5: %s -> %s"), *Waypoints[2]->GetName(), *Waypoints[4]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  4->6: %s -> %s"), *Waypoints[3]->GetName(), *Waypoints[5]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  5->6: %s -> %s"), *Waypoints[4]->GetName(), *Waypoints[5]->GetName());
+        GatherLegacyEdges(Edges);
     }
 
-    // Branch 2: 8->9, 8->10, 9->11, 10->11
-    if (Waypoints.Num() > 10)
+    TArray<AActor*> Nodes(Waypoints);
+
+    // The first waypoint is the start/finish line, so cost-to-finish becomes cost-to-lap
+    Graph->SetFinishNode(Waypoints[0]);
+    Graph->BuildGraph(Nodes, Edges);
+
+    UE_LOG(LogGADERace, Log, TEXT("AdvancedRaceManager: Built graph with %d waypoints and %d edges from %s."),
+        Waypoints.Num(), Edges.Num(), TrackTopology ? *TrackTopology->GetName() : TEXT("the built-in layout"));
+}
+
+void AAdvancedRaceManager::GatherTopologyEdges(TArray<FGraphEdgeInit>& OutEdges) const
+{
+    TMap<FName, AWaypoint*> ById;
+    ById.Reserve(Waypoints.Num());
+    for (AWaypoint* Waypoint : Waypoints)
     {
-        Graph->AddEdge(Waypoints[7], Waypoints[8]);  // 8->9
-        Graph->AddEdge(Waypoints[7], Waypoints[9]);  // 8->10
-        Graph->AddEdge(Waypoints[8], Waypoints[10]); // 9->11
-        Graph->AddEdge(Waypoints[9], Waypoints[10]); // 10->11
-        UE_LOG(LogTemp, Warning, TEXT("Branch 2 Connections:"));
-        UE_LOG(LogTemp, Warning, TEXT("  8->9:  %s -> %s"), *Waypoints[7]->GetName(), *Waypoints[8]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  8->10: %s -> %s"), *Waypoints[7]->GetName(), *Waypoints[9]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  9->11: %s -> %s"), *Waypoints[8]->GetName(), *Waypoints[10]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  10->11: %s -> %s"), *Waypoints[9]->GetName(), *Waypoints[10]->GetName());
+        ById.Add(Waypoint->GetWaypointId(), Waypoint);
     }
 
-    // Loop: 11->0
-    if (Waypoints.Num() > 11)
+    // Cooking only logs validation errors, so an asset that failed it can still get here. IDs missing
+    // from this level are skipped, and so are self and repeated edges, which the graph can't hold.
+    TSet<TPair<AWaypoint*, AWaypoint*>> Added;
+    Added.Reserve(TrackTopology->Edges.Num());
+    OutEdges.Reserve(TrackTopology->Edges.Num());
+    for (const FTrackTopologyEdge& Edge : TrackTopology->Edges)
     {
-        Graph->AddEdge(Waypoints[10], Waypoints[0]); // 11->0
-        UE_LOG(LogTemp, Warning, TEXT("Loop Connection:"));
-        UE_LOG(LogTemp, Warning, TEXT("  11->0: %s -> %s (back to start)"), *Waypoints[10]->GetName(), *Waypoints[0]->GetName());
+        AWaypoint* const* From = ById.Find(Edge.From);
+        AWaypoint* const* To = ById.Find(Edge.To);
+        if (!From || !To)
+        {
+            continue;
+        }
+
+        bool bAlreadyAdded = false;
+        Added.Add(TPair<AWaypoint*, AWaypoint*>(*From, *To), &bAlreadyAdded);
+        if (*From == *To || bAlreadyAdded)
+        {
+            UE_LOG(LogGADERaceNav, Warning, TEXT("AdvancedRaceManager: Skipping %s edge %s -> %s in %s"),
+                bAlreadyAdded ? TEXT("duplicate") : TEXT("self"), *Edge.From.ToString(), *Edge.To.ToString(), *TrackTopology->GetName());
+            continue;
+        }
+        OutEdges.Add({ *From, *To, Edge.Cost });
     }
+}
 
-    // Main loop: 0->1, 1->2, 5->6, 6->7
-    if (Waypoints.Num() > 7)
+void AAdvancedRaceManager::GatherLegacyEdges(TArray<FGraphEdgeInit>& OutEdges) const
+{
+    // The built-in layout, used when no TrackTopology asset is assigned. Entries are indices into Waypoints:
+    // main path 0->1->2 and 5->6->7, branch 1 2->[3 or 4]->5, branch 2 7->[8 or 9]->10, loop 10->0.
+    // Each group is only added when the level has at least MinWaypoints, the same thresholds the
+    // hand-written connections used, so short tracks get the same edges they always did.
+    struct FLegacyEdge
+    {
+        int32 From;
+        int32 To;
+        int32 MinWaypoints;
+    };
+    static const FLegacyEdge LegacyLayout[] =
+    {
+        { 0, 1, 8 }, { 1, 2, 8 }, { 5, 6, 8 }, { 6, 7, 8 }, // main path
+        { 2, 3, 7 }, { 2, 4, 7 }, { 3, 5, 7 }, { 4, 5, 7 }, // branch 1
+        { 7, 8, 11 }, { 7, 9, 11 }, { 8, 10, 11 }, { 9, 10, 11 }, // branch 2
+        { 10, 0, 12 }, // loop
+    };
+
+    OutEdges.Reserve(UE_ARRAY_COUNT(LegacyLayout));
+    for (const FLegacyEdge& Edge : LegacyLayout)
     {
-        Graph->AddEdge(Waypoints[0], Waypoints[1]); // 0->1
-        Graph->AddEdge(Waypoints[1], Waypoints[2]); // 1->2
-        Graph->AddEdge(Waypoints[5], Waypoints[6]); // 5->6
-        Graph->AddEdge(Waypoints[6], Waypoints[7]); // 6->7
-        UE_LOG(LogTemp, Warning, TEXT("Main Path Connections:"));
-        UE_LOG(LogTemp, Warning, TEXT("  0->1: %s -> %s (Start)"), *Waypoints[0]->GetName(), *Waypoints[1]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  1->2: %s -> %s"), *Waypoints[1]->GetName(), *Waypoints[2]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  5->6: %s -> %s"), *Waypoints[5]->GetName(), *Waypoints[6]->GetName());
-        UE_LOG(LogTemp, Warning, TEXT("  6->7: %s -> %s"), *Waypoints[6]->GetName(), *Waypoints[7]->GetName());
+        if (Waypoints.Num() >= Edge.MinWaypoints)
+        {
+            OutEdges.Add({ Waypoints[Edge.From], Waypoints[Edge.To], -1.0f });
+        }
     }
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("=== End of Waypoint Order ==="));
+int32 AAdvancedRaceManager::GetTrackIndex(const AActor* Waypoint) const
+{
+    const int32 WaypointId = UWaypointRegistrySubsystem::GetWaypointId(Waypoint);
+    return TrackIndexById.IsValidIndex(WaypointId) ? TrackIndexById[WaypointId] : INDEX_NONE;
 }
 
 AWaypoint* AAdvancedRaceManager::GetWaypoint(int32 Index)
@@ -189,6 +292,6 @@ AWaypoint* AAdvancedRaceManager::GetWaypoint(int32 Index)
     {
         return Waypoints[Index];
     }
-    UE_LOG(LogTemp, Warning, TEXT("AdvancedRaceManager: Invalid waypoint index %d."), Index);
+    GADE_LOG_RATE_LIMITED(LogGADERace, Warning, 1.0, TEXT("AdvancedRaceManager: Invalid waypoint index %d."), Index);
     return nullptr;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "Graph.h"
 #include "Waypoint.h"
 #include "BiginnerRaceGameState.h"
+#include "TrackTopology.h"
+#include "TrackSegmentTable.h"
 #include "AdvancedRaceManager.generated.h"
 
 class ABeginnerRaceGameState;
@@ -31,6 +33,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Waypoints")
     AWaypoint* GetWaypoint(int32 Index);
 
+    /** Position of Waypoint in Waypoints, looked up by its registry ID. INDEX_NONE if it isn't on the track. */
+    UFUNCTION(BlueprintCallable, Category = "Waypoints")
+    int32 GetTrackIndex(const AActor* Waypoint) const;
+
     UFUNCTION(BlueprintCallable, Category = "Waypoints")
     AGraph* GetGraph() const { return Graph; }
 
@@ -38,14 +44,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Waypoints")
     int32 GetTotalWaypoints() const { return TotalWaypoints; }
 
+    /** Track polyline through Waypoints in collection order, rebuilt by CollectWaypoints */
+    const FTrackSegmentTable& GetSegmentTable() const { return SegmentTable; }
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waypoint")
     TSubclassOf<class AWaypoint> WaypointClass;
 
+    /** Track layout keyed by waypoint ID. When unset the built-in index layout is used. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waypoint")
+    UTrackTopology* TrackTopology;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Waypoint")
     TArray<AWaypoint*> Waypoints;
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
     UPROPERTY()
@@ -57,6 +71,20 @@ private:
     UPROPERTY()
     ABeginnerRaceGameState* GameState;
 
+    /** Edges from TrackTopology, resolved against the collected waypoints, without self or duplicate edges */
+    void GatherTopologyEdges(TArray<FGraphEdgeInit>& OutEdges) const;
+
+    /** Hard-coded layout for levels without a topology asset, wired by collection order */
+    void GatherLegacyEdges(TArray<FGraphEdgeInit>& OutEdges) const;
+
+    FTrackSegmentTable SegmentTable;
+
+    TArray<int32> TrackIndexById; // registry ID -> index in Waypoints, rebuilt by CollectWaypoints
+    FDelegateHandle WaypointUnregisteredHandle;
+
+    void HandleWaypointUnregistered(int32 WaypointId, AWaypoint* Waypoint);
+    void RegisterServices(); // publishes this manager and its graph once the graph is built
+
     // New property to store total waypoints
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Waypoint", meta = (AllowPrivateAccess = "true"))
     int32 TotalWaypoints;
@@ -12,6 +12,15 @@ void UBeginnerRaceHUD::NativeConstruct()
 
     PlayerHamster = Cast<APlayerHamster>(GetOwningPlayerPawn());
     GameState = Cast<ABeginnerRaceGameState>(GetWorld()->GetGameState());
+    if (GameState)
+    {
+        GameState->OnLeaderboardChanged.AddDynamic(this, &UBeginnerRaceHUD::HandleLeaderboardChanged);
+        GameState->OnRacerLapChanged.AddDynamic(this, &UBeginnerRaceHUD::HandleRacerLapChanged);
+    }
+    if (PlayerHamster)
+    {
+        PlayerHamster->OnSpeedChanged.AddDynamic(this, &UBeginnerRaceHUD::HandleSpeedChanged);
+    }
 
     if (!LapCounter)
     {
@@ -21,65 +30,93 @@ void UBeginnerRaceHUD::NativeConstruct()
     {
         UE_LOG(LogTemp, Error, TEXT("PositionDisplay not found in WBP_HUD!"));
     }
+
+    UpdateLapCounter();
+    UpdatePositionDisplay();
+}
+
+void UBeginnerRaceHUD::NativeDestruct()
+{
+    if (GameState)
+    {
+        GameState->OnLeaderboardChanged.RemoveDynamic(this, &UBeginnerRaceHUD::HandleLeaderboardChanged);
+        GameState->OnRacerLapChanged.RemoveDynamic(this, &UBeginnerRaceHUD::HandleRacerLapChanged);
+    }
+    if (PlayerHamster)
+    {
+        PlayerHamster->OnSpeedChanged.RemoveDynamic(this, &UBeginnerRaceHUD::HandleSpeedChanged);
+    }
+
+    Super::NativeDestruct();
 }
 
 void UBeginnerRaceHUD::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
     Super::NativeTick(MyGeometry, InDeltaTime);
 
-    UpdateLapCounter();
-	UpdatePositionDisplay();
+    // However many events arrived this frame, each text is rebuilt once
+    if (bLapDirty)
+    {
+        UpdateLapCounter();
+    }
+    if (bPositionDirty)
+    {
+        UpdatePositionDisplay();
+    }
+    if (bSpeedDirty)
+    {
+        bSpeedDirty = false;
+        SpeedText = PlayerHamster
+            ? FText::FromString(FString::Printf(TEXT("Speed: %.1f km/h"), PlayerHamster->GetSpeed()))
+            : FText::FromString(TEXT("Speed: 0 km/h"));
+    }
 }
 
 void UBeginnerRaceHUD::UpdateLapCounter()
 {
+    bLapDirty = false;
     if (PlayerHamster && GameState && LapCounter)
     {
         // Get the player's lap count from the GameState's leaderboard
-        int32 CurrentLap = 0;
-        TArray<FRacerLeaderboardEntry> Leaderboard = GameState->GetLeaderboard();
-        for (const FRacerLeaderboardEntry& Entry : Leaderboard)
-        {
-            if (Entry.Racer == PlayerHamster)
-            {
-                CurrentLap = Entry.Lap;
-                break;
-            }
-        }
+        const FRacerLeaderboardEntry* Entry = GameState->FindRacerEntry(PlayerHamster);
+        const int32 CurrentLap = Entry ? Entry->Lap : 0;
 
         LapCounter->SetText(FText::FromString(FString::Printf(TEXT("Lap %d/%d"), CurrentLap, GameState->TotalLaps)));
-        UE_LOG(LogTemp, Warning, TEXT("HUD: Lap %d/%d (from GameState)"), CurrentLap, GameState->TotalLaps);
+        UE_LOG(LogTemp, Verbose, TEXT("HUD: Lap %d/%d (from GameState)"), CurrentLap, GameState->TotalLaps);
     }
 }
 
 // Function to update the position display 
 void UBeginnerRaceHUD::UpdatePositionDisplay() // Update the position display
 {
+    bPositionDirty = false;
     if (PlayerHamster && GameState && PositionDisplay)
     {
-		// Get the leaderboard from the game state and find the player's position 
-        TArray<FRacerLeaderboardEntry> Leaderboard = GameState->GetLeaderboard();
-        int32 PlayerPosition = 0;
-
-        for (const FRacerLeaderboardEntry& Entry : Leaderboard) // Loop through the leaderboard
-        {
-            if (Entry.Racer == PlayerHamster)
-            {
-                PlayerPosition = Entry.Placement;
-                break;
-            }
-        }
+        const int32 PlayerPosition = GameState->GetRacerPlacement(PlayerHamster); // O(1) lookup via the racer slot index
         PositionDisplay->SetText(FText::FromString(FString::Printf(TEXT("Position: %d"), PlayerPosition)));
-		UE_LOG(LogTemp, Warning, TEXT("Position: %d"), PlayerPosition);
+		UE_LOG(LogTemp, Verbose, TEXT("Position: %d"), PlayerPosition);
     }
 }
 
-FText UBeginnerRaceHUD::GetSpeedText() const // Function to get the speed text
+void UBeginnerRaceHUD::HandleLeaderboardChanged()
 {
-    if (PlayerHamster)
-    {
-        return FText::FromString(FString::Printf(TEXT("Speed: %.1f km/h"), PlayerHamster->GetSpeed())); // Return the speed
+    bPositionDirty = true;
+}
 
+void UBeginnerRaceHUD::HandleRacerLapChanged(AActor* Racer, int32 Lap)
+{
+    if (Racer == PlayerHamster)
+    {
+        bLapDirty = true;
     }
-    return FText::FromString(TEXT("Speed: 0 km/h")); // Return the speed
+}
+
+void UBeginnerRaceHUD::HandleSpeedChanged(float Speed)
+{
+    bSpeedDirty = true;
+}
+
+FText UBeginnerRaceHUD::GetSpeedText() const // Function to get the speed text
+{
+    return SpeedText; // Built in NativeTick when the speed changes
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ class GADE_POE_API UBeginnerRaceHUD : public UUserWidget
 	GENERATED_BODY()
 public:
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
     virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     void UpdateLapCounter();
@@ -38,4 +39,21 @@ protected:
 
    
     void UpdatePositionDisplay();
+
+    UFUNCTION()
+    void HandleLeaderboardChanged(); // placements moved, refresh the position text
+
+    UFUNCTION()
+    void HandleRacerLapChanged(AActor* Racer, int32 Lap);
+
+    UFUNCTION()
+    void HandleSpeedChanged(float Speed);
+
+private:
+    // Set by the race events, applied at most once per frame in NativeTick
+    bool bLapDirty = true;
+    bool bPositionDirty = true;
+    bool bSpeedDirty = true;
+
+    FText SpeedText; // returned by the bound GetSpeedText, rebuilt only when the speed changes
 };
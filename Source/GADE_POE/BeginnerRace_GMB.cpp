@@ -5,12 +5,21 @@
 #include "EngineUtils.h" // For TActorIterator
 ABeginnerRace_GMB::ABeginnerRace_GMB()
 {
+    // Race sounds plus the pause menu's
+    SoundPreloadSet.BuiltinSounds = { ESFXSound::Waypoint, ESFXSound::Lap, ESFXSound::Crash, ESFXSound::Engine, ESFXSound::BackgroundMusic,
+        ESFXSound::End, ESFXSound::ButtonClick, ESFXSound::ButtonHover, ESFXSound::MenuOpen, ESFXSound::MenuClose };
 }
 
 void ABeginnerRace_GMB::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Stream this mode's sounds in while the level starts
+    if (ASFXManager* SFXManager = ASFXManager::GetInstance(GetWorld()))
+    {
+        SFXManager->PreloadSounds(SoundPreloadSet);
+    }
+
 	// Show the tutorial UI
 	ShowTutorial();
 }
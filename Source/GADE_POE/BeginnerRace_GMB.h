@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "Spectator.h"
+#include "SFXManager.h"
 #include "BeginnerRace_GMB.generated.h"
 
 UCLASS()
@@ -21,6 +22,10 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "HUD")
     TSubclassOf<UUserWidget> TutorialWidgetClass; // The class of the tutorial widget
 
+    // Sounds streamed in when the level starts, so their first play doesn't wait on a load
+    UPROPERTY(EditDefaultsOnly, Category = "Audio")
+    FSFXPreloadSet SoundPreloadSet;
+
 protected:
 	void ShowTutorial(); // Function to show the tutorial UI
 };
\ No newline at end of file
@@ -1,140 +1,148 @@
 // BeginnerRaceGameState.cpp
 #include "BiginnerRaceGameState.h"
-#include "Kismet/GameplayStatics.h"
+#include "GADE_POE.h"
 #include "WaypointManager.h"
 #include "AdvancedRaceManager.h"
+#include "RaceWorldSubsystem.h"
 
 ABeginnerRaceGameState::ABeginnerRaceGameState()
 {
     TotalLaps = 2;
     TotalWaypoints = 0;
     bRaceFinished = false;
+    NumFinished = 0;
+    LeaderboardVersion = 0;
+    AdvancedManager = nullptr;
+    WaypointManager = nullptr;
 }
 
 void ABeginnerRaceGameState::BeginPlay()
 {
     Super::BeginPlay();
 
-    AAdvancedRaceManager* AdvancedManager = Cast<AAdvancedRaceManager>(
-        UGameplayStatics::GetActorOfClass(GetWorld(), AAdvancedRaceManager::StaticClass()));
-    if (AdvancedManager)
+    URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>();
+    if (!RaceServices)
     {
-        AdvancedManager->CollectWaypoints(); // Ensure waypoints are collected
+        return;
+    }
+
+    // The managers collect their waypoints in their own BeginPlay, whichever of them the level has
+    // reports in once that is done. The advanced manager wins if both do.
+    RaceServices->WhenServiceReady<AAdvancedRaceManager>(this, [this](AAdvancedRaceManager* Manager)
+    {
+        AdvancedManager = Manager;
         if (AdvancedManager->Waypoints.Num() > 0)
         {
             TotalWaypoints = AdvancedManager->Waypoints.Num();
-            UE_LOG(LogTemp, Log, TEXT("BeginnerRaceGameState: Total waypoints set to %d from AdvancedRaceManager"), TotalWaypoints);
-            return;
+            UE_LOG(LogGADERace, Log, TEXT("BeginnerRaceGameState: Total waypoints set to %d from AdvancedRaceManager"), TotalWaypoints);
         }
-    }
+    });
 
-    AWaypointManager* WaypointManager = Cast<AWaypointManager>(
-        UGameplayStatics::GetActorOfClass(GetWorld(), AWaypointManager::StaticClass()));
-    if (WaypointManager && WaypointManager->Waypoints.Num() > 0)
+    RaceServices->WhenServiceReady<AWaypointManager>(this, [this](AWaypointManager* Manager)
     {
-        TotalWaypoints = WaypointManager->Waypoints.Num();
-        UE_LOG(LogTemp, Log, TEXT("BeginnerRaceGameState: Total waypoints set to %d from WaypointManager"), TotalWaypoints);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("BeginnerRaceGameState: No waypoint source found! Ensure AdvancedRaceManager with waypoints in Advanced Race or WaypointManager in Beginner Race."));
-    }
+        WaypointManager = Manager;
+        if (!AdvancedManager && WaypointManager->Waypoints.Num() > 0)
+        {
+            TotalWaypoints = WaypointManager->Waypoints.Num();
+            UE_LOG(LogGADERace, Log, TEXT("BeginnerRaceGameState: Total waypoints set to %d from WaypointManager"), TotalWaypoints);
+        }
+    });
 }
 
 void ABeginnerRaceGameState::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
-    UpdateLeaderboard();
+    UpdateContinuousProgress();
 
-    bool bAllFinished = true;
-    for (const FRacerLeaderboardEntry& Entry : Leaderboard)
-    {
-        if (Entry.Lap < TotalLaps)
-        {
-            bAllFinished = false;
-            break;
-        }
-    }
-    if (bAllFinished && !bRaceFinished)
+    if (!bRaceFinished && NumFinished == Leaderboard.Num())
     {
         bRaceFinished = true;
-        UE_LOG(LogTemp, Log, TEXT("BeginnerRaceGameState: Race finished!"));
+        UE_LOG(LogGADERace, Log, TEXT("BeginnerRaceGameState: Race finished!"));
     }
 }
 
 void ABeginnerRaceGameState::RegisterRacer(AActor* Racer)
 {
-    if (!Racer) return;
+    if (!Racer || RacerIndices.Contains(Racer)) return;
 
+    // New racers start at lap 0, waypoint 0, so they always go to the back
     FRacerLeaderboardEntry Entry;
     Entry.Racer = Racer;
     Entry.RacerName = Racer->GetName();
     Entry.Lap = 0;
     Entry.WaypointIndex = 0;
-    Entry.Placement = 0;
-    Leaderboard.Add(Entry);
+    Entry.Placement = Leaderboard.Num() + 1;
+    Entry.Progress = 0.0f;
+    Entry.ProgressIndex = ProgressRacers.Add(Racer);
+    ProgressLaps.Add(0);
+    ProgressWaypoints.Add(0);
+    ProgressLocations.Add(Racer->GetActorLocation());
+    ProgressValues.Add(0.0f);
+    ProgressSlots.Add(Leaderboard.Add(Entry));
+    RacerIndices.Add(Racer, Entry.ProgressIndex);
 
-    UE_LOG(LogTemp, Log, TEXT("BeginnerRaceGameState: Registered racer %s"), *Entry.RacerName);
+    UE_LOG(LogGADERace, Log, TEXT("BeginnerRaceGameState: Registered racer %s"), *Entry.RacerName);
+    LeaderboardVersion++;
+    OnLeaderboardChanged.Broadcast();
 }
 
 void ABeginnerRaceGameState::UpdateRacerProgress(AActor* Racer, int32 Lap, int32 WaypointIndex)
 {
     if (!Racer)
     {
-        UE_LOG(LogTemp, Error, TEXT("BeginnerRaceGameState: Tried to update progress for null racer"));
+        GADE_LOG_RATE_LIMITED(LogGADERace, Error, 1.0, TEXT("BeginnerRaceGameState: Tried to update progress for null racer"));
         return;
     }
 
     // Validate the waypoint index
     if (WaypointIndex < 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("BeginnerRaceGameState: Invalid waypoint index %d for racer %s"), 
+        GADE_LOG_RATE_LIMITED(LogGADERace, Error, 1.0, TEXT("BeginnerRaceGameState: Invalid waypoint index %d for racer %s"), 
             WaypointIndex, *Racer->GetName());
         return;
     }
 
-    // Find and update the racer's entry
-    bool bFound = false;
-    for (FRacerLeaderboardEntry& Entry : Leaderboard)
+    const int32 Slot = FindSlot(Racer);
+    if (Slot == INDEX_NONE)
     {
-        if (Entry.Racer == Racer)
-        {
-            // Always update if the lap count has increased
-            if (Lap > Entry.Lap)
-            {
-                Entry.Lap = Lap;
-                Entry.WaypointIndex = WaypointIndex;
-                bFound = true;
-                UE_LOG(LogTemp, Warning, TEXT("BeginnerRaceGameState: Updated lap progress for %s: Lap %d, WaypointIndex %d"), 
-                    *Racer->GetName(), Lap, WaypointIndex);
-            }
-            // If on the same lap, only update if waypoint index has increased
-            else if (Lap == Entry.Lap && WaypointIndex > Entry.WaypointIndex)
-            {
-                Entry.WaypointIndex = WaypointIndex;
-                bFound = true;
-                UE_LOG(LogTemp, Warning, TEXT("BeginnerRaceGameState: Updated waypoint progress for %s: Lap %d, WaypointIndex %d"), 
-                    *Racer->GetName(), Lap, WaypointIndex);
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("BeginnerRaceGameState: Ignored invalid progress update for %s: Current(Lap:%d, WP:%d) New(Lap:%d, WP:%d)"), 
-                    *Racer->GetName(), Entry.Lap, Entry.WaypointIndex, Lap, WaypointIndex);
-            }
-            break;
-        }
+        GADE_LOG_RATE_LIMITED(LogGADERace, Error, 1.0, TEXT("BeginnerRaceGameState: Could not find leaderboard entry for racer %s"), 
+            *Racer->GetName());
+        return;
     }
 
-    if (!bFound)
+    // Progress only ever moves forward: a later lap, or a later waypoint on the same lap
+    FRacerLeaderboardEntry& Entry = Leaderboard[Slot];
+    if (Lap < Entry.Lap || (Lap == Entry.Lap && WaypointIndex <= Entry.WaypointIndex))
     {
-        UE_LOG(LogTemp, Error, TEXT("BeginnerRaceGameState: Could not find leaderboard entry for racer %s"), 
-            *Racer->GetName());
         return;
     }
 
-    // Update the leaderboard positions
-    UpdateLeaderboard();
+    if (Entry.Lap < TotalLaps && Lap >= TotalLaps)
+    {
+        NumFinished++;
+    }
+    const bool bLapChanged = Lap != Entry.Lap;
+    Entry.Lap = Lap;
+    Entry.WaypointIndex = WaypointIndex;
+
+    const int32 Index = Entry.ProgressIndex;
+    ProgressLaps[Index] = Lap;
+    ProgressWaypoints[Index] = WaypointIndex;
+    ProgressLocations[Index] = Racer->GetActorLocation();
+    ProgressValues[Index] = ComputeProgress(Index);
+    Entry.Progress = ProgressValues[Index];
+    LeaderboardVersion++;
+
+    if (bLapChanged)
+    {
+        OnRacerLapChanged.Broadcast(Racer, Lap);
+    }
+
+    if (BubbleUp(Slot))
+    {
+        OnLeaderboardChanged.Broadcast();
+    }
 }
 
 TArray<FRacerLeaderboardEntry> ABeginnerRaceGameState::GetLeaderboard() const
@@ -142,27 +150,121 @@ TArray<FRacerLeaderboardEntry> ABeginnerRaceGameState::GetLeaderboard() const
     return Leaderboard;
 }
 
-void ABeginnerRaceGameState::UpdateLeaderboard()
+int32 ABeginnerRaceGameState::GetRacerPlacement(AActor* Racer) const
+{
+    const FRacerLeaderboardEntry* Entry = FindRacerEntry(Racer);
+    return Entry ? Entry->Placement : 0;
+}
+
+const FRacerLeaderboardEntry* ABeginnerRaceGameState::FindRacerEntry(AActor* Racer) const
+{
+    const int32 Slot = FindSlot(Racer);
+    return Slot != INDEX_NONE ? &Leaderboard[Slot] : nullptr;
+}
+
+int32 ABeginnerRaceGameState::FindSlot(AActor* Racer) const
+{
+    // Keyed by weak pointer so a destroyed racer's entry can't alias a new actor, and the slot is
+    // found through its ProgressIndex so moving entries never needs the racer pointer itself
+    const int32* ProgressIndex = RacerIndices.Find(Racer);
+    return ProgressIndex ? ProgressSlots[*ProgressIndex] : INDEX_NONE;
+}
+
+bool ABeginnerRaceGameState::IsAhead(const FRacerLeaderboardEntry& A, const FRacerLeaderboardEntry& B)
+{
+    // Progress already folds in lap and waypoint index. Ties keep their current order.
+    return A.Progress > B.Progress;
+}
+
+bool ABeginnerRaceGameState::BubbleUp(int32 Slot)
 {
-    // Sort based on lap count first, then waypoint index
-    Leaderboard.Sort([](const FRacerLeaderboardEntry& A, const FRacerLeaderboardEntry& B) {
-        // First compare laps
-        if (A.Lap != B.Lap)
+    // One insertion step: enough after a single racer moves forward, and UpdateContinuousProgress
+    // runs it for every slot, which is near linear since the order barely changes between frames
+    const int32 StartSlot = Slot;
+    while (Slot > 0 && IsAhead(Leaderboard[Slot], Leaderboard[Slot - 1]))
+    {
+        Leaderboard.Swap(Slot, Slot - 1);
+
+        FRacerLeaderboardEntry& Overtaken = Leaderboard[Slot];
+        Overtaken.Placement = Slot + 1;
+        ProgressSlots[Overtaken.ProgressIndex] = Slot;
+        Slot--;
+    }
+
+    if (Slot == StartSlot)
+    {
+        return false;
+    }
+
+    FRacerLeaderboardEntry& Mover = Leaderboard[Slot];
+    Mover.Placement = Slot + 1;
+    ProgressSlots[Mover.ProgressIndex] = Slot;
+    return true;
+}
+
+const FTrackSegmentTable* ABeginnerRaceGameState::GetTrackSegments() const
+{
+    if (AdvancedManager && AdvancedManager->GetSegmentTable().IsValid())
+    {
+        return &AdvancedManager->GetSegmentTable();
+    }
+    if (WaypointManager && WaypointManager->GetSegmentTable().IsValid())
+    {
+        return &WaypointManager->GetSegmentTable();
+    }
+    return nullptr;
+}
+
+float ABeginnerRaceGameState::ComputeProgress(int32 ProgressIndex) const
+{
+    if (const FTrackSegmentTable* Segments = GetTrackSegments())
+    {
+        return ProgressLaps[ProgressIndex] + Segments->GetLapFraction(ProgressWaypoints[ProgressIndex], ProgressLocations[ProgressIndex]);
+    }
+
+    // No track geometry yet, fall back to whole waypoints
+    return ProgressLaps[ProgressIndex] + static_cast<float>(ProgressWaypoints[ProgressIndex]) / FMath::Max(TotalWaypoints, 1);
+}
+
+void ABeginnerRaceGameState::UpdateContinuousProgress()
+{
+    const int32 NumRacers = ProgressRacers.Num();
+    if (NumRacers == 0)
+    {
+        return;
+    }
+
+    for (int32 i = 0; i < NumRacers; i++)
+    {
+        if (IsValid(ProgressRacers[i]))
         {
-            return A.Lap > B.Lap;
+            ProgressLocations[i] = ProgressRacers[i]->GetActorLocation();
         }
-        // If same lap, compare waypoint index
-        return A.WaypointIndex > B.WaypointIndex;
-    });
+    }
 
-    // Update placements and log detailed progress
-    for (int32 i = 0; i < Leaderboard.Num(); i++)
+    if (const FTrackSegmentTable* Segments = GetTrackSegments())
     {
-        Leaderboard[i].Placement = i + 1;
-        UE_LOG(LogTemp, Warning, TEXT("BeginnerRaceGameState: Racer %s - Lap: %d, Waypoint: %d, Position: %d"), 
-            *Leaderboard[i].RacerName, 
-            Leaderboard[i].Lap,
-            Leaderboard[i].WaypointIndex,
-            Leaderboard[i].Placement);
+        Segments->ComputeProgress(ProgressLaps, ProgressWaypoints, ProgressLocations, ProgressValues);
     }
-}
\ No newline at end of file
+    else
+    {
+        for (int32 i = 0; i < NumRacers; i++)
+        {
+            ProgressValues[i] = ComputeProgress(i);
+        }
+    }
+
+    bool bOrderChanged = false;
+    for (int32 Slot = 0; Slot < Leaderboard.Num(); Slot++)
+    {
+        FRacerLeaderboardEntry& Entry = Leaderboard[Slot];
+        Entry.Progress = ProgressValues[Entry.ProgressIndex];
+        bOrderChanged |= BubbleUp(Slot);
+    }
+
+    if (bOrderChanged)
+    {
+        LeaderboardVersion++;
+        OnLeaderboardChanged.Broadcast();
+    }
+}
@@ -7,6 +7,10 @@
 #include "AIRacer.h"
 #include "BiginnerRaceGameState.generated.h"
 
+class AAdvancedRaceManager;
+class AWaypointManager;
+struct FTrackSegmentTable;
+
 USTRUCT(BlueprintType)
 struct FRacerLeaderboardEntry
 {
@@ -26,8 +30,16 @@ struct FRacerLeaderboardEntry
 
     UPROPERTY(BlueprintReadOnly)
     int32 Placement; // Current placement
+
+    UPROPERTY(BlueprintReadOnly)
+    float Progress; // Lap plus the fraction of the lap covered, used for placement
+
+    int32 ProgressIndex = INDEX_NONE; // Slot in the game state's per-racer progress arrays
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnLeaderboardChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRacerLapChanged, AActor*, Racer, int32, Lap);
+
 UCLASS()
 class GADE_POE_API ABeginnerRaceGameState : public AGameStateBase
 {
@@ -47,6 +59,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Leaderboard")
     TArray<FRacerLeaderboardEntry> GetLeaderboard() const;
 
+    /** Ranked entries without copying. Invalidated when a racer registers, so don't hold it across frames. */
+    TArrayView<const FRacerLeaderboardEntry> GetLeaderboardView() const { return Leaderboard; }
+
+    /** O(1) entry lookup, nullptr if Racer isn't registered */
+    const FRacerLeaderboardEntry* FindRacerEntry(AActor* Racer) const;
+
+    /**
+     * Increases whenever the roster, a lap, a waypoint index or a placement changes.
+     * Progress alone doesn't bump it, so widgets can cache their text against this.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+    int32 GetLeaderboardVersion() const { return LeaderboardVersion; }
+
+    /** Current 1-based placement of Racer, or 0 if it isn't registered */
+    UFUNCTION(BlueprintCallable, Category = "Leaderboard")
+    int32 GetRacerPlacement(AActor* Racer) const;
+
+    /** Fired when a racer joins or any placement changes, not on every progress update */
+    UPROPERTY(BlueprintAssignable, Category = "Leaderboard")
+    FOnLeaderboardChanged OnLeaderboardChanged;
+
+    /** Fired when a racer starts a new lap */
+    UPROPERTY(BlueprintAssignable, Category = "Leaderboard")
+    FOnRacerLapChanged OnRacerLapChanged;
+
     UPROPERTY(BlueprintReadOnly, Category = "Leaderboard")
     TArray<FRacerLeaderboardEntry> Leaderboard;
 
@@ -60,5 +97,30 @@ public:
     bool bRaceFinished;
 
 private:
-    void UpdateLeaderboard();
+    TMap<TWeakObjectPtr<AActor>, int32> RacerIndices; // racer -> its ProgressIndex, fixed once registered
+    int32 NumFinished; // racers that have completed TotalLaps
+    int32 LeaderboardVersion;
+
+    // Per-racer progress inputs and results, indexed by registration order (FRacerLeaderboardEntry::ProgressIndex)
+    UPROPERTY()
+    TArray<AActor*> ProgressRacers;
+    TArray<int32> ProgressSlots; // index in Leaderboard, kept in sync as entries move
+    TArray<int32> ProgressLaps;
+    TArray<int32> ProgressWaypoints;
+    TArray<FVector> ProgressLocations;
+    TArray<float> ProgressValues;
+
+    UPROPERTY()
+    AAdvancedRaceManager* AdvancedManager;
+
+    UPROPERTY()
+    AWaypointManager* WaypointManager;
+
+    int32 FindSlot(AActor* Racer) const; // index in Leaderboard, INDEX_NONE if Racer isn't registered
+    const FTrackSegmentTable* GetTrackSegments() const; // nullptr until a waypoint source has built its table
+    float ComputeProgress(int32 ProgressIndex) const;
+    void UpdateContinuousProgress(); // one batched pass over every racer, then restores the order
+
+    static bool IsAhead(const FRacerLeaderboardEntry& A, const FRacerLeaderboardEntry& B);
+    bool BubbleUp(int32 Slot); // moves an entry forward past racers it now leads, true if anything moved
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "NodePool.h"
 
 template <typename T>
 class GADE_POE_API CheckStackTemp
@@ -13,17 +14,39 @@ private:
         Node(const T& InData) : Data(InData), Next(nullptr) {}
     };
 
+public:
+    using FNodePool = TNodePool<Node>;
+
+private:
     Node* Top;
     int32 StackSize;
+    FNodePool LocalPool; // used unless the stack was given a shared pool
+    FNodePool* Pool;
 
 public:
-    CheckStackTemp() : Top(nullptr), StackSize(0) {}
+    CheckStackTemp() : Top(nullptr), StackSize(0), Pool(&LocalPool) {}
+
+    /** Allocates nodes from SharedPool, which must outlive the stack */
+    explicit CheckStackTemp(FNodePool* SharedPool) : Top(nullptr), StackSize(0), Pool(SharedPool ? SharedPool : &LocalPool) {}
+
     ~CheckStackTemp() { Clear(); }
 
+    // Nodes belong to this stack's pool, copying would alias them
+    CheckStackTemp(const CheckStackTemp&) = delete;
+    CheckStackTemp& operator=(const CheckStackTemp&) = delete;
+
+    /** Pool the nodes come from, so a temporary stack can share it */
+    FNodePool* GetPool() const { return Pool; }
+
+    const FNodePoolStats& GetPoolStats() const { return Pool->GetStats(); }
+
+    /** Pre-allocates room for NumItems more pushes */
+    void Reserve(int32 NumItems) { Pool->Reserve(NumItems); }
+
     /** Push an item onto the stack */
     void Push(const T& Item)
     {
-        Node* NewNode = new Node(Item);
+        Node* NewNode = Pool->Acquire(Item);
         NewNode->Next = Top;
         Top = NewNode;
         StackSize++;
@@ -38,7 +61,7 @@ public:
         Node* TempNode = Top; // Store the top node
         OutItem = Top->Data;
         Top = Top->Next; // Move the top pointer
-        delete TempNode;
+        Pool->Release(TempNode);
         StackSize--;
         return true;
     }
@@ -66,7 +89,7 @@ public:
         {
             Node* TempNode = Top;
             Top = Top->Next;
-            delete TempNode;
+            Pool->Release(TempNode);
         }
         StackSize = 0;
     }
@@ -1,55 +1,58 @@
 #include "CheckpointActor.h"
-#include "CheckpointManager.h"
-#include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
-#include "Engine/World.h"
-#include "EngineUtils.h"
+#include "GADE_POE.h"
+#include "Components/StaticMeshComponent.h"
 // Sets default values
 ACheckpointActor::ACheckpointActor()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    // Crossings are found by the manager's gate sweep, the checkpoint itself neither ticks nor overlaps
+    PrimaryActorTick.bCanEverTick = false;
 
 
     // Create an indicator (e.g., floating arrow, glow effect)
     IndicatorMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("IndicatorMesh"));
     IndicatorMesh->SetupAttachment(RootComponent);
     IndicatorMesh->SetVisibility(true); // Initially hidden
-
-    // Bind overlap event
-    OnActorBeginOverlap.AddDynamic(this, &ACheckpointActor::OnPlayerEnterCheckpoint);
+    IndicatorMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    IndicatorMesh->SetGenerateOverlapEvents(false);
 }
 
-// Called when the game starts or when spawned
-void ACheckpointActor::BeginPlay()
+void ACheckpointActor::PostInitializeComponents()
 {
-    Super::BeginPlay();
-
-}
+    Super::PostInitializeComponents();
 
-// Called every frame
-void ACheckpointActor::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-}
+    // Everything the checkpoint is made of, in its own space so the gate follows its rotation
+    const FBox LocalBounds = CalculateComponentsBoundingBoxInLocalSpace(true);
+    const FVector LocalCenter = LocalBounds.IsValid ? LocalBounds.GetCenter() : FVector::ZeroVector;
+    const FVector Extent = LocalBounds.IsValid ? LocalBounds.GetExtent() * GetActorScale3D().GetAbs() : FVector::ZeroVector;
 
-void ACheckpointActor::OnPlayerEnterCheckpoint(AActor* OverlappedActor, AActor* OtherActor)
-{
-    if (OtherActor && OtherActor->IsA(ACharacter::StaticClass())) // Check if the other actor is a character
+    int32 NormalAxis;
+    switch (GateAxis)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Checkpoint Passed!"));
+    case ECheckpointGateAxis::X: NormalAxis = 0; break;
+    case ECheckpointGateAxis::Y: NormalAxis = 1; break;
+    case ECheckpointGateAxis::Z: NormalAxis = 2; break;
+    default:
+        // A ring or banner is crossed through its flat side, ties go to forward
+        NormalAxis = (Extent.X <= Extent.Y && Extent.X <= Extent.Z) ? 0 : (Extent.Y <= Extent.Z ? 1 : 2);
+        break;
+    }
+    const int32 RightAxis = (NormalAxis + 1) % 3;
+    const int32 UpAxis = (NormalAxis + 2) % 3;
 
-        // Find CheckpointManager in the level
-        for (TActorIterator<ACheckpointManager> It(GetWorld()); It; ++It) // Find CheckpointManager in the level
-        {
-            ACheckpointManager* CheckpointManager = *It;
-            if (CheckpointManager)
-            {
-                CheckpointManager->PlayerReachedCheckpoint(); // Notify CheckpointManager
-                return;
-            }
-        }
+    const FQuat Rotation = GetActorQuat();
+    const FVector Axes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
 
-        UE_LOG(LogTemp, Error, TEXT("CheckpointManager not found in the level!"));
+    Gate.Center = GetActorTransform().TransformPosition(LocalCenter);
+    Gate.Normal = Axes[NormalAxis];
+    Gate.Right = Axes[RightAxis];
+    Gate.Up = Axes[UpAxis];
+    Gate.HalfExtents = GateHalfExtents.IsNearlyZero() ? FVector2D(Extent[RightAxis], Extent[UpAxis]) : GateHalfExtents;
+
+    if (Gate.HalfExtents.X <= KINDA_SMALL_NUMBER || Gate.HalfExtents.Y <= KINDA_SMALL_NUMBER)
+    {
+        // Racers would have to pass within their own radius of the centre line, the race would likely stall here
+        UE_LOG(LogGADERace, Warning, TEXT("Checkpoint %s has a degenerate gate (%.1f x %.1f), give it a mesh or set GateHalfExtents"),
+            *GetName(), Gate.HalfExtents.X, Gate.HalfExtents.Y);
     }
 }
 
@@ -6,6 +6,46 @@
 #include "GameFramework/Actor.h"
 #include "CheckpointActor.generated.h"
 
+// Which of the actor's local axes racers cross the checkpoint along
+UENUM(BlueprintType)
+enum class ECheckpointGateAxis : uint8
+{
+    Thinnest UMETA(DisplayName = "Thinnest Side of the Bounds"),
+    X UMETA(DisplayName = "Local X (Forward)"),
+    Y UMETA(DisplayName = "Local Y (Right)"),
+    Z UMETA(DisplayName = "Local Z (Up)")
+};
+
+/** A checkpoint as a rectangle racers pass through, fixed once the checkpoint is placed */
+struct FCheckpointGate
+{
+	FVector Center = FVector::ZeroVector;
+	FVector Normal = FVector::ForwardVector;
+	FVector Right = FVector::RightVector;
+	FVector Up = FVector::UpVector;
+	FVector2D HalfExtents = FVector2D::ZeroVector; // along Right and Up
+
+	/**
+	 * True if the segment Start -> End passes through the gate in either direction.
+	 * OutAlpha is where along the segment it crossed, 0 at Start and 1 at End.
+	 * Margin widens the gate, e.g. by the racer's collision radius.
+	 */
+	bool Intersects(const FVector& Start, const FVector& End, float Margin, float& OutAlpha) const
+	{
+		const float StartSide = FVector::DotProduct(Start - Center, Normal);
+		const float EndSide = FVector::DotProduct(End - Center, Normal);
+		if ((StartSide < 0.0f) == (EndSide < 0.0f))
+		{
+			return false;
+		}
+
+		OutAlpha = StartSide / (StartSide - EndSide);
+		const FVector Local = FMath::Lerp(Start, End, OutAlpha) - Center;
+		return FMath::Abs(FVector::DotProduct(Local, Right)) <= HalfExtents.X + Margin
+			&& FMath::Abs(FVector::DotProduct(Local, Up)) <= HalfExtents.Y + Margin;
+	}
+};
+
 UCLASS()
 class GADE_POE_API ACheckpointActor : public AActor
 {
@@ -16,18 +56,22 @@ public:
 	ACheckpointActor();
 
 protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
+	// Builds the gate once the components have their final bounds
+	virtual void PostInitializeComponents() override;
 
 public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	void SetCheckpointState(bool bIsNextCheckpoint,bool BIsPassed);
 
-	/** Called when player overlaps with checkpoint */
-	UFUNCTION()
-	void OnPlayerEnterCheckpoint(AActor* OverlappedActor, AActor* OtherActor); // Function to call when player enters checkpoint
+	/** Plane racers cross to pass this checkpoint, tested by ACheckpointManager every frame */
+	const FCheckpointGate& GetGate() const { return Gate; }
 
-	void SetCheckpointState(bool bIsNextCheckpoint,bool BIsPassed);
+	/** Axis racers cross the gate along. Thinnest fits a flat ring or banner however it was modelled. */
+	UPROPERTY(EditAnywhere, Category = "Checkpoint Gate")
+	ECheckpointGateAxis GateAxis = ECheckpointGateAxis::Thinnest;
+
+	/** Half width and height of the gate across GateAxis, zero to fit the actor's bounds */
+	UPROPERTY(EditAnywhere, Category = "Checkpoint Gate")
+	FVector2D GateHalfExtents = FVector2D::ZeroVector;
 
 
 	/** Indicator (e.g., floating ring or glow effect) */
@@ -40,4 +84,6 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Checkpoint Indicator")
 	UMaterialInstance* GreenMaterial;
 
+private:
+	FCheckpointGate Gate;
 };
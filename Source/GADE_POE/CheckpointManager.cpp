@@ -1,9 +1,12 @@
 ﻿#include "CheckpointManager.h"
+#include "GADE_POE.h"
 #include "CheckpointActor.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "EngineUtils.h"
+#include "GameFramework/Character.h"
 #include "CheckpointRace_GMB.h"
+#include "RaceWorldSubsystem.h"
 
 // Sets default values
 ACheckpointManager::ACheckpointManager()
@@ -17,23 +20,43 @@ void ACheckpointManager::BeginPlay()
 {
     Super::BeginPlay();
 
+    RaceStartTime = GetWorld()->GetTimeSeconds();
+
     // Find all CheckpointActors
     TArray<AActor*> FoundCheckpoints;
     UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACheckpointActor::StaticClass(), FoundCheckpoints);
 
+    // Every lap re-pushes the same checkpoints, so one up-front block covers the whole race
+    CheckpointStack.Reserve(FoundCheckpoints.Num());
+
     for (AActor* Actor : FoundCheckpoints)
     {
         ACheckpointActor* Checkpoint = Cast<ACheckpointActor>(Actor);
         if (Checkpoint)
         {
-            AddCheckpoint(Checkpoint); // Add checkpoints to the stack
             AllCheckpoints.Add(Checkpoint); // Store for resetting
         }
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Checkpoint Manager Initialized! Stack Size: %d"), CheckpointStack.Size()); // Log stack size
+    // Same push as every later lap, so the required order never changes between laps.
+    // Also broadcasts, the HUD may have been built before the stack was filled
+    ResetCheckpoints();
+
+    UE_LOG(LogGADERace, Log, TEXT("Checkpoint Manager Initialized! Stack Size: %d"), CheckpointStack.Size()); // Log stack size
 
-    GetNextCheckpoint();
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->RegisterService(this);
+    }
+}
+
+void ACheckpointManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->UnregisterService(this);
+    }
+    Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
@@ -41,9 +64,19 @@ void ACheckpointManager::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
+    // Before the timer, so a checkpoint crossed in the frame time ran out still adds its time
+    SweepNextGate(DeltaTime);
+
     // Update the remaining time
     RemainingTime -= DeltaTime;
 
+    const int32 RemainingSeconds = FMath::FloorToInt(FMath::Max(RemainingTime, 0.0f));
+    if (RemainingSeconds != LastBroadcastSeconds)
+    {
+        LastBroadcastSeconds = RemainingSeconds;
+        OnRemainingTimeChanged.Broadcast(RemainingSeconds);
+    }
+
     // Check if the timer has expired
     if (RemainingTime <= 0.0f)
     {
@@ -56,25 +89,90 @@ void ACheckpointManager::AddCheckpoint(ACheckpointActor* Checkpoint) // Add chec
     if (Checkpoint)
     {
         CheckpointStack.Push(Checkpoint);
-        UE_LOG(LogTemp, Warning, TEXT("Checkpoint Added: %s"), *Checkpoint->GetName());
+        UE_LOG(LogGADERace, Verbose, TEXT("Checkpoint Added: %s"), *Checkpoint->GetName());
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Tried to add a null checkpoint!"));
+        UE_LOG(LogGADERace, Error, TEXT("Tried to add a null checkpoint!"));
+    }
+}
+
+void ACheckpointManager::GatherRacers()
+{
+    // Any character passes checkpoints, as with the old overlap trigger
+    int32 NumRacers = 0;
+    for (TActorIterator<ACharacter> It(GetWorld()); It; ++It)
+    {
+        ACharacter* Character = *It;
+        if (!IsValid(Character))
+        {
+            continue;
+        }
+
+        if (NumRacers == Racers.Num())
+        {
+            Racers.Add(nullptr);
+            PreviousPositions.AddZeroed();
+            Positions.AddZeroed();
+            RacerRadii.Add(0.0f);
+        }
+
+        Positions[NumRacers] = Character->GetActorLocation();
+        if (Racers[NumRacers] != Character)
+        {
+            // New or respawned character, don't sweep from where the last one was
+            Racers[NumRacers] = Character;
+            PreviousPositions[NumRacers] = Positions[NumRacers];
+            RacerRadii[NumRacers] = Character->GetSimpleCollisionRadius();
+        }
+        NumRacers++;
+    }
+
+    Racers.SetNum(NumRacers);
+    PreviousPositions.SetNum(NumRacers);
+    Positions.SetNum(NumRacers);
+    RacerRadii.SetNum(NumRacers);
+}
+
+void ACheckpointManager::SweepNextGate(float DeltaTime)
+{
+    GatherRacers();
+
+    // Crossings are placed between the start of this frame and now on the world clock
+    const double FrameStartTime = GetWorld()->GetTimeSeconds() - DeltaTime;
+
+    for (int32 i = 0; i < Racers.Num(); i++)
+    {
+        // A fast racer can pass several gates in one frame, each one further along its movement
+        float LastAlpha = -1.0f;
+        float Alpha = 0.0f;
+        ACheckpointActor* NextCheckpoint;
+        while (CheckpointStack.Peek(NextCheckpoint) && IsValid(NextCheckpoint)
+            && NextCheckpoint->GetGate().Intersects(PreviousPositions[i], Positions[i], RacerRadii[i], Alpha)
+            && Alpha > LastAlpha)
+        {
+            LastAlpha = Alpha;
+            CheckpointPassed(FrameStartTime + Alpha * DeltaTime);
+        }
+
+        PreviousPositions[i] = Positions[i];
     }
 }
 
 void ACheckpointManager::PlayerReachedCheckpoint()
 {
-    // Prevent multiple triggers for the same checkpoint
-    if (bCheckpointCleared) return;
-    bCheckpointCleared = true;
+    CheckpointPassed(GetWorld()->GetTimeSeconds());
+}
 
+void ACheckpointManager::CheckpointPassed(double CrossingTime)
+{
     ACheckpointActor* ReachedCheckpoint;
     if (CheckpointStack.Pop(ReachedCheckpoint))
     {
+        SplitTimes.Add(static_cast<float>(CrossingTime - RaceStartTime));
+
         // Log checkpoint progress
-        UE_LOG(LogTemp, Warning, TEXT("Checkpoint Passed: %s"), *ReachedCheckpoint->GetName());
+        UE_LOG(LogGADERace, Log, TEXT("Checkpoint Passed: %s at %.3fs"), *ReachedCheckpoint->GetName(), SplitTimes.Last());
 
         if (IsValid(ReachedCheckpoint))
         { 
@@ -100,12 +198,12 @@ void ACheckpointManager::PlayerReachedCheckpoint()
             // Start new lap
             CurrentLap++;
             ResetCheckpoints();
-            UE_LOG(LogTemp, Warning, TEXT("Lap %d/%d Completed!"), CurrentLap - 1, TotalLaps);
+            UE_LOG(LogGADERace, Log, TEXT("Lap %d/%d Completed!"), CurrentLap - 1, TotalLaps);
         }
         else
         {
             // Race finished
-            UE_LOG(LogTemp, Warning, TEXT("Race Finished!"));
+            UE_LOG(LogGADERace, Log, TEXT("Race Finished!"));
             ACheckpointRace_GMB* GameMode = Cast<ACheckpointRace_GMB>(UGameplayStatics::GetGameMode(GetWorld()));
             if (GameMode)
             {
@@ -119,8 +217,7 @@ void ACheckpointManager::PlayerReachedCheckpoint()
         GetNextCheckpoint();
     }
 
-    // Reset checkpoint cleared flag on next tick
-    GetWorldTimerManager().SetTimerForNextTick([this]() { bCheckpointCleared = false; });
+    OnCheckpointProgressChanged.Broadcast();
 }
 
 ACheckpointActor* ACheckpointManager::GetNextCheckpoint() // Get the next checkpoint
@@ -136,9 +233,12 @@ ACheckpointActor* ACheckpointManager::GetNextCheckpoint() // Get the next checkp
 
 void ACheckpointManager::ResetCheckpoints()
 {
-    UE_LOG(LogTemp, Warning, TEXT("Resetting Checkpoints for New Lap..."));
+    UE_LOG(LogGADERace, Log, TEXT("Resetting Checkpoints for Lap %d..."), CurrentLap);
 
-    for (int32 i = AllCheckpoints.Num() - 1; i >= 0; i--) // Push in reverse
+    // Pushed in reverse so AllCheckpoints[0] is on top. SweepNextGate only tests the top,
+    // so this is the order every lap has to be driven in
+    CheckpointStack.Clear();
+    for (int32 i = AllCheckpoints.Num() - 1; i >= 0; i--)
     {
         if (IsValid(AllCheckpoints[i]))
         {
@@ -146,26 +246,28 @@ void ACheckpointManager::ResetCheckpoints()
         }
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Checkpoints Reset! Stack Size: %d"), CheckpointStack.Size());
+    UE_LOG(LogGADERace, Log, TEXT("Checkpoints Reset! Stack Size: %d"), CheckpointStack.Size());
+    GetNextCheckpoint(); // highlight the lap's first gate
+    OnCheckpointProgressChanged.Broadcast();
 }
 
 void ACheckpointManager::DebugCheckpointStatus()
 {
     if (CheckpointStack.IsEmpty())
     {
-        UE_LOG(LogTemp, Error, TEXT("No checkpoints left in stack!"));
+        UE_LOG(LogGADERace, Error, TEXT("No checkpoints left in stack!"));
         return;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("----- Debugging Checkpoints -----"));
+    UE_LOG(LogGADERace, Verbose, TEXT("----- Debugging Checkpoints -----"));
 
-    CheckStackTemp<ACheckpointActor*> TempStack; // Use a temporary stack
+    CheckStackTemp<ACheckpointActor*> TempStack(CheckpointStack.GetPool()); // Temporary stack reusing the nodes popped off the real one
     while (!CheckpointStack.IsEmpty())
     {
         ACheckpointActor* Checkpoint;
         if (CheckpointStack.Pop(Checkpoint) && IsValid(Checkpoint))
         {
-            UE_LOG(LogTemp, Warning, TEXT("Checkpoint: %s"), *Checkpoint->GetName());
+            UE_LOG(LogGADERace, Verbose, TEXT("Checkpoint: %s"), *Checkpoint->GetName());
             DrawDebugSphere(GetWorld(), Checkpoint->GetActorLocation(), 50.0f, 12, FColor::Red, false, 5.0f);
 
             TempStack.Push(Checkpoint);
@@ -180,7 +282,7 @@ void ACheckpointManager::DebugCheckpointStatus()
         CheckpointStack.Push(Checkpoint);
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("----- End Debug -----"));
+    UE_LOG(LogGADERace, Verbose, TEXT("----- End Debug -----"));
 }
 
 // Get the number of checkpoints reached
@@ -191,7 +293,7 @@ int32 ACheckpointManager::GetRemainingCheckpoint() const
 
 void ACheckpointManager::HandleTimerExpiry()
 {
-    UE_LOG(LogTemp, Warning, TEXT("Time's up!"));
+    UE_LOG(LogGADERace, Log, TEXT("Time's up!"));
 
     // Handle the timer expiry (e.g., end the race, show UI, etc.)
     ACheckpointRace_GMB* GameMode = Cast<ACheckpointRace_GMB>(UGameplayStatics::GetGameMode(GetWorld()));
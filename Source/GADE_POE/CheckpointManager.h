@@ -11,6 +11,10 @@
 
 // Forward declarations
 class ACheckpointActor;
+class ACharacter;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCheckpointProgressChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRemainingTimeChanged, int32, RemainingSeconds);
 
 UCLASS()
 class GADE_POE_API ACheckpointManager : public AActor
@@ -25,6 +29,7 @@ public:
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Stack storing all checkpoints */
 	CheckStackTemp <ACheckpointActor*> CheckpointStack; // Stack of checkpoints
@@ -37,15 +42,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Checkpoints")
 	void AddCheckpoint(ACheckpointActor* Checkpoint);
 
-	/** Called when the player reaches a checkpoint */
+	/** Passes the next checkpoint now. Crossings are normally found by the gate sweep in Tick. */
 	UFUNCTION(BlueprintCallable, Category = "Checkpoints")
 	void PlayerReachedCheckpoint(); // Player reached a checkpoint
 
+	/** Seconds since the race started at which each checkpoint so far was crossed, to within the frame */
+	UFUNCTION(BlueprintCallable, Category = "Checkpoints")
+	const TArray<float>& GetSplitTimes() const { return SplitTimes; }
+
 	/** Gets the next checkpoint */
 	UFUNCTION(BlueprintCallable, Category = "Checkpoints")
 	ACheckpointActor* GetNextCheckpoint(); // Get the next checkpoint
 
-	/** Resets the checkpoints */
+	/** Refills the stack for a lap, first found checkpoint on top */
 	UFUNCTION(BlueprintCallable, Category = "Checkpoints")
 	void ResetCheckpoints();
 
@@ -71,6 +80,14 @@ public:
 
 	float RemainingTime;
 
+	/** Fired when a checkpoint is passed, a lap starts or the checkpoints reset */
+	UPROPERTY(BlueprintAssignable, Category = "Checkpoints")
+	FOnCheckpointProgressChanged OnCheckpointProgressChanged;
+
+	/** Fired when the whole seconds left change, the HUD shows nothing finer */
+	UPROPERTY(BlueprintAssignable, Category = "Timer")
+	FOnRemainingTimeChanged OnRemainingTimeChanged;
+
 	
 	void HandleTimerExpiry();
 
@@ -79,9 +96,23 @@ public:
 	USoundBase* CheckpointReachedSound; // Sound effect for che
 
 private:
-	bool bCheckpointCleared = false; // Flag to prevent multiple calls
+	int32 LastBroadcastSeconds = INDEX_NONE; // whole seconds at the last OnRemainingTimeChanged
 
 	int32 TotalLaps = 2; // Set total laps
 	int32 CurrentLap = 1; // Start at lap 1
 	TArray<ACheckpointActor*> AllCheckpoints; // Store checkpoints for resetting
+
+	double RaceStartTime = 0.0; // world time at BeginPlay
+	TArray<float> SplitTimes;
+
+	// Each character in the race, swept from its last position to its current one through the next gate
+	UPROPERTY()
+	TArray<ACharacter*> Racers;
+	TArray<FVector> PreviousPositions;
+	TArray<FVector> Positions;
+	TArray<float> RacerRadii;
+
+	void GatherRacers();
+	void SweepNextGate(float DeltaTime);
+	void CheckpointPassed(double CrossingTime);
 };
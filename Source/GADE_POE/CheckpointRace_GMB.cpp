@@ -3,17 +3,26 @@
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "CheckpointManager.h"
+#include "RaceWorldSubsystem.h"
 #include "RaceEndWidget.h"
 
 ACheckpointRace_GMB::ACheckpointRace_GMB()
 {
-   
+    // Race sounds plus the pause menu's
+    SoundPreloadSet.BuiltinSounds = { ESFXSound::Checkpoint, ESFXSound::Lap, ESFXSound::Crash, ESFXSound::Engine, ESFXSound::BackgroundMusic,
+        ESFXSound::End, ESFXSound::ButtonClick, ESFXSound::ButtonHover, ESFXSound::MenuOpen, ESFXSound::MenuClose };
 }
 
 void ACheckpointRace_GMB::BeginPlay()
 {
     Super::BeginPlay();
 
+    // Stream this mode's sounds in while the level starts
+    if (ASFXManager* SFXManager = ASFXManager::GetInstance(GetWorld()))
+    {
+        SFXManager->PreloadSounds(SoundPreloadSet);
+    }
+
 	// Show the tutorial UI
 	ShowTutorial();
 
@@ -35,11 +44,12 @@ void ACheckpointRace_GMB::BeginPlay()
     }
 
 	// Set the race state to running
-    CheckpointManager = Cast<ACheckpointManager>(UGameplayStatics::GetActorOfClass(GetWorld(), ACheckpointManager::StaticClass()));
-
-    if (!CheckpointManager)
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
     {
-        UE_LOG(LogTemp, Error, TEXT("CheckpointManager not found!"));
+        RaceServices->WhenServiceReady<ACheckpointManager>(this, [this](ACheckpointManager* Manager)
+        {
+            CheckpointManager = Manager;
+        });
     }
 
 }
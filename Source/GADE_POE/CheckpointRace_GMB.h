@@ -5,6 +5,7 @@
 #include "CheckpointManager.h"
 #include "Blueprint/UserWidget.h"
 #include "RaceEndWidget.h"
+#include "SFXManager.h"
 #include "CheckpointRace_GMB.generated.h"
 
 UCLASS()
@@ -30,6 +31,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "HUD")
 	TSubclassOf<UUserWidget> RaceEndWidgetClass; // Class for the race end
 
+	// Sounds streamed in when the level starts, so their first play doesn't wait on a load
+	UPROPERTY(EditDefaultsOnly, Category = "Audio")
+	FSFXPreloadSet SoundPreloadSet;
+
 private:
 	UPROPERTY() // Property for the race HUD
 	UUserWidget* RaceHUDWidget;
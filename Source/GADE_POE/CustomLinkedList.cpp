@@ -3,11 +3,17 @@
 
 UCustomLinkedList::UCustomLinkedList()
 {
+    WaypointList.SetIndexed(true);
 }
 
 // Add an element to the end of the list
 void UCustomLinkedList::Add(AActor* Data) 
 {
+    // Keep the first position if an actor is added twice, matching the old front-to-back search
+    if (!PositionIndex.Contains(Data))
+    {
+        PositionIndex.Add(Data, WaypointList.GetCount());
+    }
     WaypointList.Add(Data);
 }
 
@@ -27,6 +33,7 @@ int32 UCustomLinkedList::GetCount() const
 void UCustomLinkedList::Clear()
 {
     WaypointList.Clear();
+    PositionIndex.Reset();
 }
 
 // Get the first element
@@ -37,16 +44,13 @@ AActor* UCustomLinkedList::GetFirst() const
 
 AActor* UCustomLinkedList::GetNext(AActor* Current) const
 {
-	// Check if the current element is valid
-    int32 Count = WaypointList.GetCount();
-    for (int32 i = 0; i < Count; ++i)
+    // Look the current element up instead of walking the list
+    const int32* Position = PositionIndex.Find(Current);
+    if (!Position)
     {
-        if (WaypointList.GetAt(i) == Current)
-        {
-            int32 NextIndex = (i + 1) % Count; // Loop back to start
-            return WaypointList.GetAt(NextIndex);
-        }
+        return nullptr; // Return nullptr if the current element is not found
     }
 
-    return nullptr; // Return nullptr if the current element is not found
+    const int32 NextIndex = (*Position + 1) % WaypointList.GetCount(); // Loop back to start
+    return WaypointList.GetAt(NextIndex);
 }
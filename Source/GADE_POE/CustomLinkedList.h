@@ -10,7 +10,8 @@ class GADE_POE_API UCustomLinkedList : public UObject
     GENERATED_BODY()
 
 private:
-    TempLinkedList<AActor*> WaypointList;
+    TempLinkedList<AActor*> WaypointList; // indexed, so GetAt is O(1)
+    TMap<AActor*, int32> PositionIndex; // first position of each actor, for GetNext
 
 public:
     UCustomLinkedList();
@@ -3,102 +3,126 @@
 #include "CoreMinimal.h"
 
 /**
- * A custom Queue implementation using TLinkedList (FIFO structure)
+ * A custom Queue implementation (FIFO structure)
+ * Items live in a growable ring buffer, so enqueue and dequeue don't allocate once the
+ * buffer is big enough and the size is a counter rather than a walk.
  */
 template <typename T>
 class DialogueQueueTemp
 {
 public:
-    DialogueQueueTemp() : Head(nullptr), Tail(nullptr) {}
-    ~DialogueQueueTemp()
-    {
-        Clear();
-    }
+    DialogueQueueTemp() : Front(0), Count(0) {}
 
     /** Adds an item to the queue */
     void Enqueue(const T& Item)
     {
-        TNode* NewNode = new TNode(Item);
-        if (!Tail) // If queue is empty, set both head and tail
-        {
-            Head = Tail = NewNode;
-        }
-        else
-        {
-            Tail->Next = NewNode;
-            Tail = NewNode;
-        }
-
-        UE_LOG(LogTemp, Warning, TEXT("Enqueued item: %s"), *Item.Name);
+        GrowIfFull();
+        Items[SlotOf(Count)] = Item;
+        Count++;
     }
 
+    /** Adds an item to the queue, taking its contents instead of copying them */
+    void Enqueue(T&& Item)
+    {
+        GrowIfFull();
+        Items[SlotOf(Count)] = MoveTemp(Item);
+        Count++;
+    }
 
     /** Removes and returns the front item of the queue */
     bool Dequeue(T& OutItem)
     {
-        if (!Head) return false; // Queue is empty
+        if (Count == 0) return false; // Queue is empty
 
-        OutItem = Head->Data;
-        TNode* OldHead = Head;
-        Head = Head->Next;
+        OutItem = MoveTemp(Items[Front]);
+        Items[Front] = T(); // don't keep the moved-from item's leftovers alive
+        Front = SlotOf(1);
+        Count--;
 
-        if (!Head) // If queue is now empty, reset tail
+        if (Count == 0) // restart at the beginning of the buffer
         {
-            Tail = nullptr;
+            Front = 0;
         }
-
-        delete OldHead;
         return true;
     }
 
     /** Returns the front item without removing it */
     bool Peek(T& OutItem) const
     {
-        if (!Head) return false;
-        OutItem = Head->Data;
+        if (Count == 0) return false;
+        OutItem = Items[Front];
         return true;
     }
 
     /** Checks if the queue is empty */
     bool IsEmpty() const
     {
-        return Head == nullptr;
+        return Count == 0;
     }
 
-    /** Clears the queue */
+    /** Clears the queue, keeping the buffer for the next load */
     void Clear()
     {
-        while (Head)
+        for (int32 i = 0; i < Count; i++)
         {
-            TNode* Temp = Head;
-            Head = Head->Next;
-            delete Temp;
+            Items[SlotOf(i)] = T();
         }
-        Tail = nullptr;
+        Front = 0;
+        Count = 0;
     }
 
     int32 GetSize() const
     {
-        int32 Count = 0;
-        TNode* Temp = Head;
-        while (Temp)
-        {
-            Count++;
-            Temp = Temp->Next;
-        }
         return Count;
     }
 
+    int32 GetCapacity() const
+    {
+        return Items.Num();
+    }
+
+    /** Makes room for NumItems more items, so a bulk load grows the buffer once */
+    void Reserve(int32 NumItems)
+    {
+        const int32 Needed = Count + NumItems;
+        if (Needed > Items.Num())
+        {
+            Resize(Needed);
+        }
+    }
 
 private:
-    /** Internal node structure */
-    struct TNode
+    TArray<T> Items; // ring storage, the size is always a power of two
+    int32 Front; // slot of the front item
+    int32 Count; // items in the queue
+
+    /** Slot of the item Offset places behind the front */
+    int32 SlotOf(int32 Offset) const
+    {
+        return (Front + Offset) & (Items.Num() - 1);
+    }
+
+    void GrowIfFull()
+    {
+        if (Count == Items.Num())
+        {
+            Resize(Count + 1);
+        }
+    }
+
+    /** Reallocates to the next power of two that fits MinCapacity and unwraps the items to the start */
+    void Resize(int32 MinCapacity)
     {
-        T Data;
-        TNode* Next;
-        TNode(const T& InData) : Data(InData), Next(nullptr) {}
-    };
+        const int32 NewCapacity = FMath::RoundUpToPowerOfTwo(FMath::Max(MinCapacity, 8));
 
-    TNode* Head; // Front of the queue
-    TNode* Tail; // Back of the queue
+        TArray<T> NewItems;
+        NewItems.SetNum(NewCapacity);
+        for (int32 i = 0; i < Count; i++)
+        {
+            NewItems[i] = MoveTemp(Items[SlotOf(i)]);
+        }
+
+        Items = MoveTemp(NewItems);
+        Front = 0;
+    }
 };
@@ -33,6 +33,7 @@ void UDialogueWidget::NativeConstruct()
     if (NextButton)
     {
         NextButton->OnClicked.AddDynamic(this, &UDialogueWidget::OnNextButtonClicked);
+        NextButton->SetIsEnabled(false); // until the dialogue has loaded, see HandleDialogueLoaded
     }
 
     // Get current level name
@@ -122,28 +123,55 @@ void UDialogueWidget::NativeConstruct()
     UE_LOG(LogTemp, Warning, TEXT("DialogueWidget: Final JsonFile selected: %s"), *JsonFile);
     UE_LOG(LogTemp, Warning, TEXT("DialogueWidget: Final TargetRaceLevel selected: %s"), *TargetRaceLevel.ToString());
 
-    // Load dialogue data
-    DialogueData = NewObject<UDialogue_Data>();
-    if (DialogueData->LoadDialogue(JsonFile))
+    // Load dialogue data off the game thread, the loading screen covers the wait
+    DialogueData = NewObject<UDialogue_Data>(this);
+    DialogueData->OnDialogueLoaded.AddDynamic(this, &UDialogueWidget::HandleDialogueLoaded);
+    PendingJsonFile = JsonFile;
+
+    ShowLoadingScreen();
+    UpdateLoadingProgress(0.0f);
+    DialogueData->LoadDialogueAsync(JsonFile);
+}
+
+void UDialogueWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    if (DialogueData && DialogueData->IsLoading())
     {
-        UE_LOG(LogTemp, Warning, TEXT("DialogueWidget: Successfully loaded dialogue from %s"), *JsonFile);
-        OnNextButtonClicked();
+        UpdateLoadingProgress(DialogueData->GetLoadProgress());
     }
-    else
+
+    if (IsTyping())
     {
-        UE_LOG(LogTemp, Error, TEXT("DialogueWidget: Failed to load JSON file %s"), *JsonFile);
+        AdvanceTyping(InDeltaTime);
     }
 }
 
-void UDialogueWidget::NativeDestruct()
+void UDialogueWidget::HandleDialogueLoaded(bool bSuccess)
 {
-    // Clear the typing timer
-    if (GetWorld() && GetWorld()->GetTimerManager().IsTimerActive(TypingTimerHandle))
+    UpdateLoadingProgress(1.0f);
+    HideLoadingScreen();
+
+    // Even a failed load lets the player click through to the race
+    if (NextButton)
     {
-        UE_LOG(LogTemp, Warning, TEXT("DialogueWidget: Clearing active TypingTimerHandle"));
-        GetWorld()->GetTimerManager().ClearTimer(TypingTimerHandle);
+        NextButton->SetIsEnabled(true);
     }
 
+    if (bSuccess)
+    {
+        UE_LOG(LogTemp, Log, TEXT("DialogueWidget: Successfully loaded dialogue from %s"), *PendingJsonFile);
+        OnNextButtonClicked();
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("DialogueWidget: Failed to load JSON file %s"), *PendingJsonFile);
+    }
+}
+
+void UDialogueWidget::NativeDestruct()
+{
     // Remove loading screen widget
     if (LoadingScreenWidget)
     {
@@ -153,6 +181,10 @@ void UDialogueWidget::NativeDestruct()
 
     // Nullify pointers
     LoadingProgressSlider = nullptr;
+    if (DialogueData)
+    {
+        DialogueData->OnDialogueLoaded.RemoveDynamic(this, &UDialogueWidget::HandleDialogueLoaded);
+    }
     DialogueData = nullptr;
 
     // Unbind button delegate
@@ -173,7 +205,6 @@ void UDialogueWidget::DisplayDialogue(FDialogue_Item DialogueItem)
 
     if (DialogueTextBlock)
     {
-        DialogueTextBlock->SetText(FText::FromString(DialogueItem.DialogueText));
         StartTypingEffect(DialogueItem.DialogueText);
     }
 
@@ -194,6 +225,19 @@ void UDialogueWidget::DisplayDialogue(FDialogue_Item DialogueItem)
 
 void UDialogueWidget::OnNextButtonClicked()
 {
+    // The queue is still empty while loading, moving on now would skip the whole scene
+    if (DialogueData && DialogueData->IsLoading())
+    {
+        return;
+    }
+
+    // The first click finishes the line being typed, the next one moves on
+    if (IsTyping())
+    {
+        SkipTyping();
+        return;
+    }
+
     if (DialogueData && !DialogueData->IsQueueEmpty())
     {
         FDialogue_Item NextDialogue = DialogueData->GetNextDialogue();
@@ -271,7 +315,7 @@ void UDialogueWidget::LoadLevelAsync(const FName& LevelName)
 
 void UDialogueWidget::UpdateLoadingProgress(float Progress)
 {
-    if (LoadingScreenWidget)
+    if (LoadingProgressSlider)
     {
         LoadingProgressSlider->SetValue(Progress);
     }
@@ -280,25 +324,66 @@ void UDialogueWidget::UpdateLoadingProgress(float Progress)
 void UDialogueWidget::StartTypingEffect(const FString& FullText)
 {
     CurrentText = FullText;
-    DisplayedText = TEXT("");
-    CurrentCharIndex = 0;
+    DisplayedText.Reset(FullText.Len()); // sized once, revealing never reallocates
+    RevealProgress = 0.0f;
+    TypingRateScale = 1.0f;
+    SetVisibleChars(0);
+}
 
-    GetWorld()->GetTimerManager().SetTimer(TypingTimerHandle, this, &UDialogueWidget::TypeNextLetter, 0.05f, true);
+void UDialogueWidget::SetTypingRate(float RateScale)
+{
+    TypingRateScale = FMath::Max(RateScale, 0.0f);
+}
+
+void UDialogueWidget::SkipTyping()
+{
+    RevealProgress = CurrentText.Len();
+    SetVisibleChars(CurrentText.Len());
 }
 
-void UDialogueWidget::TypeNextLetter()
+void UDialogueWidget::AdvanceTyping(float DeltaTime)
 {
-    if (CurrentCharIndex < CurrentText.Len())
+    // Reveal by elapsed time, so a slow frame catches up instead of slowing the text down
+    RevealProgress = FMath::Min(RevealProgress + DeltaTime * TypingSpeed * TypingRateScale, static_cast<float>(CurrentText.Len()));
+    const int32 Target = FMath::FloorToInt(RevealProgress);
+    if (Target <= VisibleChars)
+    {
+        return;
+    }
+
+    // Reveal whole words, which keeps the text block from re-laying out the line for every letter
+    // and stops a word jumping to the next line halfway through. Text without spaces, such as
+    // some localised lines, still advances once a run gets long.
+    static const int32 MaxRevealRun = 8;
+    int32 RevealEnd = Target;
+    if (Target < CurrentText.Len())
     {
-        DisplayedText.AppendChar(CurrentText[CurrentCharIndex]);
-        if (DialogueTextBlock)
+        while (RevealEnd > VisibleChars && !FChar::IsWhitespace(CurrentText[RevealEnd]))
         {
-            DialogueTextBlock->SetText(FText::FromString(DisplayedText));
+            RevealEnd--;
+        }
+        if (RevealEnd == VisibleChars)
+        {
+            if (Target - VisibleChars < MaxRevealRun)
+            {
+                return;
+            }
+            RevealEnd = Target;
         }
-        CurrentCharIndex++;
     }
-    else
+
+    SetVisibleChars(RevealEnd);
+}
+
+void UDialogueWidget::SetVisibleChars(int32 Count)
+{
+    // Called at most once a frame, however many characters came due since the last one
+    DisplayedText.Reset();
+    DisplayedText.Append(*CurrentText, Count);
+    VisibleChars = Count;
+
+    if (DialogueTextBlock)
     {
-        GetWorld()->GetTimerManager().ClearTimer(TypingTimerHandle);
+        DialogueTextBlock->SetText(FText::FromString(DisplayedText));
     }
 }
\ No newline at end of file
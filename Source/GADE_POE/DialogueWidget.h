@@ -14,6 +14,7 @@ class GADE_POE_API UDialogueWidget : public UUserWidget
 public:
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     UFUNCTION(BlueprintCallable, Category = "Dialogue")
     void DisplayDialogue(FDialogue_Item DialogueItem);
@@ -24,6 +25,21 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue")
     FName TargetRaceLevel;
 
+    // Characters the typewriter effect reveals per second
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue", meta = (ClampMin = "1"))
+    float TypingSpeed = 20.0f;
+
+    // Scales TypingSpeed for the current line, e.g. 2 while a fast-forward button is held
+    UFUNCTION(BlueprintCallable, Category = "Dialogue")
+    void SetTypingRate(float RateScale);
+
+    // Shows the rest of the current line at once
+    UFUNCTION(BlueprintCallable, Category = "Dialogue")
+    void SkipTyping();
+
+    UFUNCTION(BlueprintPure, Category = "Dialogue")
+    bool IsTyping() const { return VisibleChars < CurrentText.Len(); }
+
 protected:
     UPROPERTY(meta = (BindWidget))
     class UTextBlock* SpeakerNameText;
@@ -70,11 +86,18 @@ private:
     void LoadLevelAsync(const FName& LevelName);
     void UpdateLoadingProgress(float Progress);
 
-    FString CurrentText;
-    FString DisplayedText;
-    int32 CurrentCharIndex;
-    FTimerHandle TypingTimerHandle;
+    UFUNCTION()
+    void HandleDialogueLoaded(bool bSuccess);
+
+    FString PendingJsonFile; // file being loaded in the background, for logging
+
+    FString CurrentText; // the whole line being typed
+    FString DisplayedText; // reused buffer for the revealed part
+    float RevealProgress = 0.0f; // characters due to be shown, advanced by elapsed time
+    int32 VisibleChars = 0; // characters currently in the text block
+    float TypingRateScale = 1.0f;
 
     void StartTypingEffect(const FString& FullText);
-    void TypeNextLetter();
+    void AdvanceTyping(float DeltaTime);
+    void SetVisibleChars(int32 Count);
 };
\ No newline at end of file
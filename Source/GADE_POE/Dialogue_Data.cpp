@@ -1,18 +1,140 @@
 #include "Dialogue_Data.h"
 #include "Json.h"
-#include "JsonUtilities.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "JsonObjectConverter.h"
 #include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Hash/CityHash.h"
+#include "Async/Async.h"
+
+namespace
+{
+    constexpr uint32 DialogueCacheMagic = 0x44434831; // "DCH1"
+    constexpr int32 DialogueCacheVersion = 1; // bump when the fields FDialogue_Item serializes change
+
+    /** Stores one scalar value into the matching FDialogue_Item field, unknown fields are ignored */
+    void ReadDialogueField(TJsonReader<>& Reader, EJsonNotation Notation, FDialogue_Item& Item)
+    {
+        // Field names match case-insensitively, the same as FJsonObjectConverter did
+        const FString& Field = Reader.GetIdentifier();
+
+        if (Field.Equals(TEXT("Age"), ESearchCase::IgnoreCase))
+        {
+            Item.Age = Notation == EJsonNotation::Number
+                ? static_cast<int32>(Reader.GetValueAsNumber())
+                : FCString::Atoi(*Reader.GetValueAsString());
+            return;
+        }
+
+        if (Notation != EJsonNotation::String)
+        {
+            return;
+        }
+
+        FString* Target = nullptr;
+        if (Field.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+        {
+            Target = &Item.Name;
+        }
+        else if (Field.Equals(TEXT("SpeakerName"), ESearchCase::IgnoreCase))
+        {
+            Target = &Item.SpeakerName;
+        }
+        else if (Field.Equals(TEXT("SpeakerPortrait"), ESearchCase::IgnoreCase))
+        {
+            Target = &Item.SpeakerPortrait;
+        }
+        else if (Field.Equals(TEXT("DialogueText"), ESearchCase::IgnoreCase))
+        {
+            Target = &Item.DialogueText;
+        }
+
+        if (Target)
+        {
+            *Target = Reader.GetValueAsString();
+        }
+    }
+}
 
 bool UDialogue_Data::LoadDialogue(const FString& FileName)
 {
     DialogueQueue.Clear();  // Clear queue before loading new data
+    PendingLoad.Reset(); // a blocking load replaces any async one still running
 
     FString FilePath = FPaths::ProjectDir() + "Content/JSONFILES/" + FileName;
-    UE_LOG(LogTemp, Warning, TEXT("Dialogue_Data: Full file path: %s"), *FilePath);
+    UE_LOG(LogTemp, Log, TEXT("Dialogue_Data: Full file path: %s"), *FilePath);
+
+    TArray<FDialogue_Item> Items;
+    if (!ReadDialogueItems(FilePath, Items))
+    {
+        return false;
+    }
+
+    QueueItems(Items);
+    return true;
+}
+
+void UDialogue_Data::LoadDialogueAsync(const FString& FileName)
+{
+    DialogueQueue.Clear();
+
+    TSharedPtr<FLoadTask, ESPMode::ThreadSafe> Task = MakeShared<FLoadTask, ESPMode::ThreadSafe>();
+    Task->FilePath = FPaths::ProjectDir() + "Content/JSONFILES/" + FileName;
+    PendingLoad = Task;
+
+    UE_LOG(LogTemp, Log, TEXT("Dialogue_Data: Loading %s in the background"), *Task->FilePath);
+
+    TWeakObjectPtr<UDialogue_Data> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [Task, WeakThis]()
+    {
+        // Only the task is touched here, the UObject is left to the game thread
+        Task->bSuccess = ReadDialogueItems(Task->FilePath, Task->Items, &Task->Progress);
+
+        AsyncTask(ENamedThreads::GameThread, [Task, WeakThis]()
+        {
+            UDialogue_Data* This = WeakThis.Get();
+            if (!This || This->PendingLoad != Task)
+            {
+                return; // the data object is gone or a newer load replaced this one
+            }
+
+            This->PendingLoad.Reset();
+            if (Task->bSuccess)
+            {
+                This->QueueItems(Task->Items);
+            }
+            This->OnDialogueLoaded.Broadcast(Task->bSuccess);
+        });
+    });
+}
+
+float UDialogue_Data::GetLoadProgress() const
+{
+    return PendingLoad.IsValid() ? PendingLoad->Progress.load() : 1.0f;
+}
+
+void UDialogue_Data::QueueItems(TArray<FDialogue_Item>& Items)
+{
+    DialogueQueue.Reserve(Items.Num()); // one allocation for the whole file
+    for (FDialogue_Item& Item : Items)
+    {
+        DialogueQueue.Enqueue(MoveTemp(Item));
+    }
+    Items.Reset();
+
+    UE_LOG(LogTemp, Log, TEXT("Dialogue_Data: Queued %d dialogue lines"), DialogueQueue.GetSize());
+}
+
+bool UDialogue_Data::ReadDialogueItems(const FString& FilePath, TArray<FDialogue_Item>& OutItems, std::atomic<float>* Progress)
+{
+    auto SetProgress = [Progress](float Value)
+    {
+        if (Progress)
+        {
+            Progress->store(Value);
+        }
+    };
 
     // Check if file exists
     if (!FPaths::FileExists(FilePath))
@@ -21,63 +143,188 @@ bool UDialogue_Data::LoadDialogue(const FString& FileName)
         return false;
     }
 
+    TArray<uint8> FileBytes;
+    if (!FFileHelper::LoadFileToArray(FileBytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Failed to load file: %s"), *FilePath);
+        return false;
+    }
+    SetProgress(0.25f);
+
+    // The cache is keyed by the file's contents, so editing the JSON invalidates it
+    const uint64 SourceHash = CityHash64(reinterpret_cast<const char*>(FileBytes.GetData()), FileBytes.Num());
+    const FString CachePath = GetCachePath(FilePath);
+    if (LoadCache(CachePath, SourceHash, OutItems))
+    {
+        UE_LOG(LogTemp, Log, TEXT("Dialogue_Data: Loaded %d dialogue lines from cache %s"), OutItems.Num(), *CachePath);
+        SetProgress(1.0f);
+        return true;
+    }
+    SetProgress(0.5f);
+
     FString JsonString;
-    if (FFileHelper::LoadFileToString(JsonString, *FilePath))
+    FFileHelper::BufferToString(JsonString, FileBytes.GetData(), FileBytes.Num());
+    FileBytes.Empty();
+    UE_LOG(LogTemp, Log, TEXT("Dialogue_Data: Successfully loaded JSON file with length: %d"), JsonString.Len());
+
+    if (!ParseDialogueJson(JsonString, OutItems))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Dialogue_Data: Successfully loaded JSON file with length: %d"), JsonString.Len());
+        return false;
+    }
+    SetProgress(0.9f);
 
-        TArray<TSharedPtr<FJsonValue>> JsonArray;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    SaveCache(CachePath, SourceHash, OutItems);
+    SetProgress(1.0f);
+    return true;
+}
 
-        if (FJsonSerializer::Deserialize(Reader, JsonArray))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Dialogue_Data: Successfully parsed JSON array with %d entries"), JsonArray.Num());
+bool UDialogue_Data::ParseDialogueJson(const FString& JsonString, TArray<FDialogue_Item>& OutItems)
+{
+    // Walks the reader's token stream and writes each field straight into its item,
+    // so no DOM or per-value shared pointer is ever built
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::CreateFromView(JsonString);
+
+    EJsonNotation Notation;
+    if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ArrayStart)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Failed to parse JSON as an array. %s"), *Reader->GetErrorMessage());
+        return false;
+    }
 
-            for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray)
+    OutItems.Reset();
+    FDialogue_Item* Item = nullptr; // entry being filled, null between entries
+    int32 SkipDepth = 0; // nesting inside a value the dialogue schema doesn't use
+    bool bFinished = false;
+
+    while (!bFinished && Reader->ReadNext(Notation))
+    {
+        if (SkipDepth > 0)
+        {
+            if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+            {
+                SkipDepth++;
+            }
+            else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
             {
-                if (!JsonValue.IsValid() || !JsonValue->AsObject().IsValid())
-                {
-                    UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Invalid JSON entry detected! Skipping..."));
-                    continue;
-                }
-
-                FDialogue_Item DialogueItem;
-                if (FJsonObjectConverter::JsonObjectToUStruct(JsonValue->AsObject().ToSharedRef(), &DialogueItem))
-                {
-                    DialogueQueue.Enqueue(DialogueItem);
-                    UE_LOG(LogTemp, Warning, TEXT("Dialogue_Data: Successfully loaded dialogue: %s - %s"),
-                        *DialogueItem.Name, *DialogueItem.DialogueText);
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Failed to convert JSON to FDialogue_Item!"));
-                }
+                SkipDepth--;
             }
-            return true;
+            continue;
         }
-        else
+
+        switch (Notation)
         {
-            UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Failed to parse JSON as an array. JSON content: %s"), *JsonString);
+        case EJsonNotation::ObjectStart:
+            if (Item)
+            {
+                SkipDepth = 1;
+            }
+            else
+            {
+                Item = &OutItems.AddDefaulted_GetRef();
+            }
+            break;
+
+        case EJsonNotation::ObjectEnd:
+            Item = nullptr;
+            break;
+
+        case EJsonNotation::ArrayStart:
+            if (!Item)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Invalid JSON entry detected! Skipping..."));
+            }
+            SkipDepth = 1;
+            break;
+
+        case EJsonNotation::ArrayEnd:
+            bFinished = true; // end of the top-level array
+            break;
+
+        case EJsonNotation::String:
+        case EJsonNotation::Number:
+            if (Item)
+            {
+                ReadDialogueField(*Reader, Notation, *Item);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Invalid JSON entry detected! Skipping..."));
+            }
+            break;
+
+        default:
+            break; // booleans and nulls carry nothing the schema uses
         }
     }
-    else
+
+    if (!bFinished)
     {
-        UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Failed to load file: %s"), *FilePath);
+        UE_LOG(LogTemp, Error, TEXT("Dialogue_Data: Failed to parse JSON. %s"), *Reader->GetErrorMessage());
+        OutItems.Reset();
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Dialogue_Data: Successfully parsed JSON array with %d entries"), OutItems.Num());
+    return true;
+}
+
+FString UDialogue_Data::GetCachePath(const FString& FilePath)
+{
+    return FPaths::ProjectSavedDir() / TEXT("DialogueCache") / FPaths::GetBaseFilename(FilePath) + TEXT(".bin");
+}
+
+bool UDialogue_Data::LoadCache(const FString& CachePath, uint64 SourceHash, TArray<FDialogue_Item>& OutItems)
+{
+    TArray<uint8> CacheBytes;
+    if (!FFileHelper::LoadFileToArray(CacheBytes, *CachePath, FILEREAD_Silent))
+    {
+        return false; // no cache yet
+    }
+
+    FMemoryReader Reader(CacheBytes);
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint64 CachedHash = 0;
+    Reader << Magic << Version << CachedHash;
+    if (Reader.IsError() || Magic != DialogueCacheMagic || Version != DialogueCacheVersion || CachedHash != SourceHash)
+    {
+        return false; // stale or from an older build, the caller rebuilds it
     }
 
-    return false;
+    Reader << OutItems;
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Dialogue_Data: Cache %s is corrupt, reparsing the JSON"), *CachePath);
+        OutItems.Reset();
+        return false;
+    }
+    return true;
+}
+
+void UDialogue_Data::SaveCache(const FString& CachePath, uint64 SourceHash, TArray<FDialogue_Item>& Items)
+{
+    TArray<uint8> CacheBytes;
+    FMemoryWriter Writer(CacheBytes);
+    uint32 Magic = DialogueCacheMagic;
+    int32 Version = DialogueCacheVersion;
+    Writer << Magic << Version << SourceHash << Items;
+
+    if (!FFileHelper::SaveArrayToFile(CacheBytes, *CachePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Dialogue_Data: Could not write dialogue cache %s"), *CachePath);
+    }
 }
 
 
 
 FDialogue_Item UDialogue_Data::GetNextDialogue()
 {
-    UE_LOG(LogTemp, Warning, TEXT("Queue size BEFORE dequeue: %d"), DialogueQueue.GetSize());
+    UE_LOG(LogTemp, Verbose, TEXT("Queue size BEFORE dequeue: %d"), DialogueQueue.GetSize());
 
     FDialogue_Item NextDialogue;
     if (DialogueQueue.Dequeue(NextDialogue))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Dequeued: %s - %s"), *NextDialogue.Name, *NextDialogue.DialogueText);
+        UE_LOG(LogTemp, Verbose, TEXT("Dequeued: %s - %s"), *NextDialogue.Name, *NextDialogue.DialogueText);
         return NextDialogue;
     }
 
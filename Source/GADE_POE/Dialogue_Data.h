@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Engine/DataTable.h"
+#include <atomic>
 #include "DIalogueQueueTemp.h"
 #include "Dialogue_Data.generated.h"
 
@@ -34,8 +35,18 @@ struct FDialogue_Item : public FTableRowBase
     FDialogue_Item(const FString& InName, const FString& InSpeaker, const FString& InPortrait, const FString& InText, int32 InAge)
         : Name(InName), SpeakerName(InSpeaker), SpeakerPortrait(InPortrait), DialogueText(InText), Age(InAge) {
     }
+
+    /** Binary form used by the dialogue cache */
+    friend FArchive& operator<<(FArchive& Ar, FDialogue_Item& Item)
+    {
+        Ar << Item.Name << Item.SpeakerName << Item.SpeakerPortrait << Item.DialogueText << Item.Age;
+        return Ar;
+    }
 };
 
+/** Broadcast on the game thread when LoadDialogueAsync finishes */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDialogueLoaded, bool, bSuccess);
+
 UCLASS()
 class GADE_POE_API UDialogue_Data : public UObject
 {
@@ -46,6 +57,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dialogue")
     bool LoadDialogue(const FString& FileName);
 
+    /** Reads and parses the file on a worker thread and queues the items when done. OnDialogueLoaded fires either way. */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue")
+    void LoadDialogueAsync(const FString& FileName);
+
+    UFUNCTION(BlueprintCallable, Category = "Dialogue")
+    bool IsLoading() const { return PendingLoad.IsValid(); }
+
+    /** Rough progress of the running async load, 0 to 1 */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue")
+    float GetLoadProgress() const;
+
+    UPROPERTY(BlueprintAssignable, Category = "Dialogue")
+    FOnDialogueLoaded OnDialogueLoaded;
+
     /** Retrieves the next dialogue item */
     UFUNCTION(BlueprintCallable, Category = "Dialogue")
     FDialogue_Item GetNextDialogue();
@@ -53,6 +78,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Dialogue")
     bool IsQueueEmpty() const;
 
+    /** Streams the JSON array token by token into OutItems, only the FDialogue_Item fields are read */
+    static bool ParseDialogueJson(const FString& JsonString, TArray<FDialogue_Item>& OutItems);
+
 private:
 
     DialogueQueueTemp<FDialogue_Item> DialogueQueue;
@@ -61,4 +89,24 @@ private:
 
     /** Keeps track of the current dialogue position */
     int32 CurrentIndex = 0;
+
+    /** State shared with the worker running an async load */
+    struct FLoadTask
+    {
+        FString FilePath;
+        TArray<FDialogue_Item> Items;
+        std::atomic<float> Progress{ 0.0f };
+        bool bSuccess = false;
+    };
+
+    TSharedPtr<FLoadTask, ESPMode::ThreadSafe> PendingLoad;
+
+    void QueueItems(TArray<FDialogue_Item>& Items);
+
+    /** Fills OutItems from the binary cache if it matches the file, otherwise parses the JSON and refreshes the cache. Safe off the game thread. */
+    static bool ReadDialogueItems(const FString& FilePath, TArray<FDialogue_Item>& OutItems, std::atomic<float>* Progress = nullptr);
+
+    static FString GetCachePath(const FString& FilePath);
+    static bool LoadCache(const FString& CachePath, uint64 SourceHash, TArray<FDialogue_Item>& OutItems);
+    static void SaveCache(const FString& CachePath, uint64 SourceHash, TArray<FDialogue_Item>& Items);
 };
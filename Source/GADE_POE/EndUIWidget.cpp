@@ -129,41 +129,47 @@ void UEndUIWidget::OnQuitClicked()
 // Function to update the UI with the player's position and leaderboard 
 void UEndUIWidget::UpdateUI()
 {
-    if (GameState && LeaderboardText)
+    if (!GameState)
     {
-		// Get the leaderboard from the game state and format it as a string
-        TArray<FRacerLeaderboardEntry> Rankings = GameState->GetLeaderboard();
+        return;
+    }
+
+    // Skip the rebuild when nothing on the leaderboard changed since the last call
+    const int32 Version = GameState->GetLeaderboardVersion();
+    if (Version == LastLeaderboardVersion)
+    {
+        return;
+    }
+    LastLeaderboardVersion = Version;
+
+    TArrayView<const FRacerLeaderboardEntry> Rankings = GameState->GetLeaderboardView();
+
+    if (LeaderboardText)
+    {
+		// Format the leaderboard as a string, it's already ordered by placement
         FString LeaderboardString = TEXT("Leaderboard:\n");
-		// Sort the leaderboard by placement
-        for (int32 i = 0; i < Rankings.Num(); ++i) 
+        LeaderboardString.Reserve(64 * (Rankings.Num() + 1));
+        for (const FRacerLeaderboardEntry& Entry : Rankings)
         {
-            const FRacerLeaderboardEntry& Entry = Rankings[i];
-            FString EntryString = FString::Printf(TEXT("%d. %s (Lap %d, Waypoint %d)\n"),
-                Entry.Placement, *Entry.RacerName, Entry.Lap, Entry.WaypointIndex);
-
             // Highlight top 3
-            if (Entry.Placement == 1)
+            const TCHAR* Style = Entry.Placement == 1 ? TEXT("Gold") : Entry.Placement == 2 ? TEXT("Silver") : Entry.Placement == 3 ? TEXT("Bronze") : nullptr;
+            if (Style)
             {
-                EntryString = FString::Printf(TEXT("<Gold>%s</>"), *EntryString);
+                LeaderboardString.Appendf(TEXT("<%s>%d. %s (Lap %d, Waypoint %d)\n</>"),
+                    Style, Entry.Placement, *Entry.RacerName, Entry.Lap, Entry.WaypointIndex);
             }
-            else if (Entry.Placement == 2)
+            else
             {
-                EntryString = FString::Printf(TEXT("<Silver>%s</>"), *EntryString);
+                LeaderboardString.Appendf(TEXT("%d. %s (Lap %d, Waypoint %d)\n"),
+                    Entry.Placement, *Entry.RacerName, Entry.Lap, Entry.WaypointIndex);
             }
-            else if (Entry.Placement == 3)
-            {
-                EntryString = FString::Printf(TEXT("<Bronze>%s</>"), *EntryString);
-            }
-
-            LeaderboardString += EntryString;
         }
 		LeaderboardText->SetText(FText::FromString(LeaderboardString)); // Set the leaderboard text
     }
 
 	// Update the player's position in the leaderboard
-    if (GameState && PositionText)
+    if (PositionText)
     {
-        TArray<FRacerLeaderboardEntry> Rankings = GameState->GetLeaderboard();
         int32 PlayerRank = -1;
 		// Find the player's rank in the leaderboard
         for (const FRacerLeaderboardEntry& Entry : Rankings)
@@ -54,4 +54,6 @@ private:
 
     UPROPERTY()
 	URaceGameInstance* GameInstance; // The game instance
+
+    int32 LastLeaderboardVersion = INDEX_NONE; // leaderboard version the texts were built from
 };
\ No newline at end of file
@@ -3,4 +3,8 @@
 #include "GADE_POE.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogGADERace);
+DEFINE_LOG_CATEGORY(LogGADERaceAI);
+DEFINE_LOG_CATEGORY(LogGADERaceNav);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, GADE_POE, "GADE_POE" );
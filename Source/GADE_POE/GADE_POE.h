@@ -4,3 +4,76 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * Race log categories. The third argument is the compile-time ceiling: UE_LOG calls more verbose
+ * than it are removed by the compiler, format arguments and all. Hot categories cover code that
+ * runs per frame or per event (AI steering, waypoint arrival, container lookups) and keep only
+ * errors in test and shipping builds. Define either ceiling in GADE_POE.Build.cs to override it.
+ */
+#ifndef GADE_RACE_LOG_CEILING
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+#define GADE_RACE_LOG_CEILING Warning
+#else
+#define GADE_RACE_LOG_CEILING All
+#endif
+#endif
+
+#ifndef GADE_RACE_HOT_LOG_CEILING
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+#define GADE_RACE_HOT_LOG_CEILING Error
+#else
+#define GADE_RACE_HOT_LOG_CEILING All
+#endif
+#endif
+
+DECLARE_LOG_CATEGORY_EXTERN(LogGADERace, Log, GADE_RACE_LOG_CEILING); // race flow: laps, checkpoints, standings
+DECLARE_LOG_CATEGORY_EXTERN(LogGADERaceAI, Log, GADE_RACE_HOT_LOG_CEILING); // AI racers and their controllers
+DECLARE_LOG_CATEGORY_EXTERN(LogGADERaceNav, Log, GADE_RACE_HOT_LOG_CEILING); // waypoints, the track graph and containers
+
+/**
+ * Lets one log call site through at most once per interval and counts the calls it held back.
+ * Each GADE_LOG_RATE_LIMITED site owns one. Not thread safe, use it from the game thread.
+ */
+struct FGADELogRateLimiter
+{
+    double NextLogTime = 0.0;
+    int32 Suppressed = 0;
+
+    /** True if the site may log now, OutSuppressed is how many calls were dropped since it last did */
+    bool TryLog(double IntervalSeconds, int32& OutSuppressed)
+    {
+        const double Now = FPlatformTime::Seconds();
+        if (Now < NextLogTime)
+        {
+            Suppressed++;
+            return false;
+        }
+        NextLogTime = Now + IntervalSeconds;
+        OutSuppressed = Suppressed;
+        Suppressed = 0;
+        return true;
+    }
+};
+
+/**
+ * UE_LOG for call sites that can fire every frame: logs at most once every IntervalSeconds and
+ * reports how many messages were skipped in between. When the verbosity is compiled out or
+ * suppressed at runtime, neither the limiter nor the format arguments are evaluated.
+ */
+#define GADE_LOG_RATE_LIMITED(CategoryName, Verbosity, IntervalSeconds, Format, ...) \
+    do \
+    { \
+        if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+        { \
+            static FGADELogRateLimiter GADELogLimiter; \
+            int32 GADELogSuppressed = 0; \
+            if (GADELogLimiter.TryLog(IntervalSeconds, GADELogSuppressed)) \
+            { \
+                if (GADELogSuppressed > 0) \
+                { \
+                    UE_LOG(CategoryName, Verbosity, TEXT("(%d messages like the next were suppressed)"), GADELogSuppressed); \
+                } \
+                UE_LOG(CategoryName, Verbosity, Format, ##__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
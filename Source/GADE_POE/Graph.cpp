@@ -1,4 +1,7 @@
 #include "Graph.h"
+#include "GADE_POE.h"
+#include "Algo/Reverse.h"
+#include "WaypointRegistrySubsystem.h"
 
 AGraph::AGraph()
 {
@@ -9,22 +12,23 @@ void AGraph::AddNode(AActor* Waypoint)
 {
     if (!Waypoint || !Waypoint->IsValidLowLevel())
     {
-        UE_LOG(LogTemp, Error, TEXT("Graph::AddNode - NULL or invalid waypoint"));
+        UE_LOG(LogGADERaceNav, Error, TEXT("Graph::AddNode - NULL or invalid waypoint"));
         return;
     }
     if (PendingRemoval.Contains(Waypoint))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Graph::AddNode - Waypoint %s is pending removal"), *Waypoint->GetName());
+        UE_LOG(LogGADERaceNav, Warning, TEXT("Graph::AddNode - Waypoint %s is pending removal"), *Waypoint->GetName());
         return;
     }
     if (!Nodes.Get(Waypoint))
     {
         Nodes.Add(Waypoint, FGraphNode(Waypoint));
-        UE_LOG(LogTemp, Log, TEXT("Graph::AddNode - Added waypoint: %s"), *Waypoint->GetName());
+        Unbake();
+        UE_LOG(LogGADERaceNav, Log, TEXT("Graph::AddNode - Added waypoint: %s"), *Waypoint->GetName());
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("Graph::AddNode - Waypoint already exists: %s"), *Waypoint->GetName());
+        UE_LOG(LogGADERaceNav, Warning, TEXT("Graph::AddNode - Waypoint already exists: %s"), *Waypoint->GetName());
     }
 }
 
@@ -32,12 +36,27 @@ void AGraph::AddEdge(AActor* From, AActor* To)
 {
     if (!From || !From->IsValidLowLevel() || !To || !To->IsValidLowLevel())
     {
-        UE_LOG(LogTemp, Error, TEXT("Graph::AddEdge - Invalid actor pointers"));
+        UE_LOG(LogGADERaceNav, Error, TEXT("Graph::AddEdge - Invalid actor pointers"));
+        return;
+    }
+    AddWeightedEdge(From, To, FVector::Dist(From->GetActorLocation(), To->GetActorLocation()));
+}
+
+void AGraph::AddWeightedEdge(AActor* From, AActor* To, float Cost)
+{
+    if (!From || !From->IsValidLowLevel() || !To || !To->IsValidLowLevel())
+    {
+        UE_LOG(LogGADERaceNav, Error, TEXT("Graph::AddEdge - Invalid actor pointers"));
+        return;
+    }
+    if (Cost < 0.0f)
+    {
+        UE_LOG(LogGADERaceNav, Error, TEXT("Graph::AddEdge - Negative cost %f from %s to %s"), Cost, *From->GetName(), *To->GetName());
         return;
     }
     if (PendingRemoval.Contains(From) || PendingRemoval.Contains(To))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Graph::AddEdge - Waypoint(s) pending removal: From=%s, To=%s"),
+        UE_LOG(LogGADERaceNav, Warning, TEXT("Graph::AddEdge - Waypoint(s) pending removal: From=%s, To=%s"),
             *From->GetName(), *To->GetName());
         return;
     }
@@ -45,53 +64,370 @@ void AGraph::AddEdge(AActor* From, AActor* To)
     FGraphNode* ToNode = Nodes.Get(To);
     if (FromNode && ToNode)
     {
-        FromNode->Neighbors.Add(To);
-        UE_LOG(LogTemp, Log, TEXT("Graph::AddEdge - Added edge from %s to %s"), *From->GetName(), *To->GetName());
+        FromNode->Neighbors.Add(FGraphEdge(To, Cost));
+        Unbake();
+        UE_LOG(LogGADERaceNav, Log, TEXT("Graph::AddEdge - Added edge from %s to %s (cost %.1f)"), *From->GetName(), *To->GetName(), Cost);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("Graph::AddEdge - Invalid nodes: From=%s, To=%s"),
+        UE_LOG(LogGADERaceNav, Warning, TEXT("Graph::AddEdge - Invalid nodes: From=%s, To=%s"),
             FromNode ? *From->GetName() : TEXT("null"), ToNode ? *To->GetName() : TEXT("null"));
     }
 }
 
 TArray<AActor*> AGraph::GetNeighbors(AActor* Waypoint)
 {
-    TArray<AActor*> Result;
+    return TArray<AActor*>(GetNeighborsView(Waypoint));
+}
 
+TArrayView<AActor* const> AGraph::GetNeighborsView(AActor* Waypoint)
+{
     if (!Waypoint || !Waypoint->IsValidLowLevel())
     {
-        UE_LOG(LogTemp, Error, TEXT("Graph::GetNeighbors - Waypoint is NULL or invalid!"));
-        return Result;
+        GADE_LOG_RATE_LIMITED(LogGADERaceNav, Error, 1.0, TEXT("Graph::GetNeighbors - Waypoint is NULL or invalid!"));
+        return TArrayView<AActor* const>();
     }
     if (PendingRemoval.Contains(Waypoint))
     {
-        UE_LOG(LogTemp, Warning, TEXT("Graph::GetNeighbors - Waypoint %s is pending removal"), *Waypoint->GetName());
-        return Result;
+        GADE_LOG_RATE_LIMITED(LogGADERaceNav, Warning, 1.0, TEXT("Graph::GetNeighbors - Waypoint %s is pending removal"), *Waypoint->GetName());
+        return TArrayView<AActor* const>();
+    }
+
+    const int32 Index = GetBakedIndex(Waypoint);
+    if (Index == INDEX_NONE)
+    {
+        GADE_LOG_RATE_LIMITED(LogGADERaceNav, Error, 1.0, TEXT("Graph::GetNeighbors - Waypoint %s not found in Nodes map!"), *Waypoint->GetName());
+        return TArrayView<AActor* const>();
+    }
+
+    const int32 Begin = EdgeOffsets[Index];
+    const int32 End = EdgeOffsets[Index + 1];
+    return TArrayView<AActor* const>(EdgeTargets.GetData() + Begin, End - Begin);
+}
+
+TArrayView<const int32> AGraph::GetNeighborIdsView(int32 WaypointId)
+{
+    const int32 Index = GetBakedIndexById(WaypointId);
+    if (Index == INDEX_NONE)
+    {
+        return TArrayView<const int32>();
+    }
+
+    const int32 Begin = EdgeOffsets[Index];
+    const int32 End = EdgeOffsets[Index + 1];
+    return TArrayView<const int32>(EdgeTargetIds.GetData() + Begin, End - Begin);
+}
+
+void AGraph::BuildGraph(const TArray<AActor*>& InNodes, const TArray<FGraphEdgeInit>& InEdges)
+{
+    Nodes.Clear();
+    Nodes.Reserve(InNodes.Num());
+    for (AActor* Waypoint : InNodes)
+    {
+        if (Waypoint && Waypoint->IsValidLowLevel())
+        {
+            Nodes.Add(Waypoint, FGraphNode(Waypoint));
+        }
+    }
+
+    int32 SkippedEdges = 0;
+    for (const FGraphEdgeInit& Edge : InEdges)
+    {
+        FGraphNode* FromNode = Nodes.Get(Edge.From);
+        if (!FromNode || !Nodes.Get(Edge.To))
+        {
+            SkippedEdges++;
+            continue;
+        }
+        const float Cost = Edge.Cost >= 0.0f ? Edge.Cost : FVector::Dist(Edge.From->GetActorLocation(), Edge.To->GetActorLocation());
+        FromNode->Neighbors.Add(FGraphEdge(Edge.To, Cost));
+    }
+
+    if (SkippedEdges > 0)
+    {
+        UE_LOG(LogGADERaceNav, Warning, TEXT("Graph::BuildGraph - Skipped %d edges with missing waypoints"), SkippedEdges);
+    }
+
+    Bake();
+}
+
+int32 AGraph::GetBakedIndex(AActor* Waypoint)
+{
+    if (!bBaked)
+    {
+        Bake();
+    }
+
+    // Registered waypoints resolve through an array, the hash map is only for other actors
+    const int32 WaypointId = UWaypointRegistrySubsystem::GetWaypointId(Waypoint);
+    if (BakedIndexById.IsValidIndex(WaypointId) && BakedIndexById[WaypointId] != INDEX_NONE)
+    {
+        return BakedIndexById[WaypointId];
+    }
+
+    const FGraphNode* Node = Waypoint ? Nodes.Get(Waypoint) : nullptr;
+    return Node && BakedNodes.IsValidIndex(Node->BakedIndex) ? Node->BakedIndex : INDEX_NONE;
+}
+
+int32 AGraph::GetBakedIndexById(int32 WaypointId)
+{
+    if (!bBaked)
+    {
+        Bake();
+    }
+    return BakedIndexById.IsValidIndex(WaypointId) ? BakedIndexById[WaypointId] : INDEX_NONE;
+}
+
+void AGraph::Bake()
+{
+    TArray<AActor*> Keys;
+    Nodes.GetAllKeys(Keys);
+
+    BakedNodes.Reset(Keys.Num());
+    BakedLocations.Reset(Keys.Num());
+    EdgeOffsets.Reset(Keys.Num() + 1);
+    EdgeTargets.Reset();
+    EdgeTargetIndices.Reset();
+    EdgeTargetIds.Reset();
+    EdgeCosts.Reset();
+    BakedIndexById.Reset();
+
+    // Assign dense indices first so edges to removed or invalid nodes can be dropped below
+    for (AActor* Key : Keys)
+    {
+        if (FGraphNode* Node = Nodes.Get(Key))
+        {
+            Node->BakedIndex = PendingRemoval.Contains(Key) ? INDEX_NONE : BakedNodes.Add(Key);
+        }
+    }
+
+    int32 MaxWaypointId = INDEX_NONE;
+    for (AActor* Key : BakedNodes)
+    {
+        BakedLocations.Add(Key->GetActorLocation());
+        MaxWaypointId = FMath::Max(MaxWaypointId, UWaypointRegistrySubsystem::GetWaypointId(Key));
+    }
+
+    BakedIndexById.Init(INDEX_NONE, MaxWaypointId + 1);
+    for (int32 i = 0; i < BakedNodes.Num(); i++)
+    {
+        const int32 WaypointId = UWaypointRegistrySubsystem::GetWaypointId(BakedNodes[i]);
+        if (WaypointId != INDEX_NONE)
+        {
+            BakedIndexById[WaypointId] = i;
+        }
+    }
+
+    // The distance heuristic stays admissible as long as it never exceeds the cheapest cost per unit distance
+    HeuristicScale = 1.0f;
+    for (AActor* Key : BakedNodes)
+    {
+        EdgeOffsets.Add(EdgeTargets.Num());
+        const FGraphNode* Node = Nodes.Get(Key);
+        for (TNode<FGraphEdge>* Current = Node->Neighbors.GetHead(); Current; Current = Current->Next)
+        {
+            const FGraphNode* Target = Nodes.Get(Current->Data.To);
+            if (Target && Target->BakedIndex != INDEX_NONE)
+            {
+                EdgeTargets.Add(Current->Data.To);
+                EdgeTargetIndices.Add(Target->BakedIndex);
+                EdgeTargetIds.Add(UWaypointRegistrySubsystem::GetWaypointId(Current->Data.To));
+                EdgeCosts.Add(Current->Data.Cost);
+
+                const float Distance = FVector::Dist(BakedLocations[Node->BakedIndex], BakedLocations[Target->BakedIndex]);
+                if (Distance > KINDA_SMALL_NUMBER)
+                {
+                    HeuristicScale = FMath::Min(HeuristicScale, Current->Data.Cost / Distance);
+                }
+            }
+        }
     }
+    EdgeOffsets.Add(EdgeTargets.Num());
 
-    FGraphNode* Node = Nodes.Get(Waypoint);
-    if (!Node)
+    bBaked = true;
+    ComputeCostToFinish();
+    UE_LOG(LogGADERaceNav, Log, TEXT("Graph::Bake - Baked %d nodes and %d edges"), BakedNodes.Num(), EdgeTargets.Num());
+}
+
+namespace
+{
+    struct FOpenEntry
     {
-        UE_LOG(LogTemp, Error, TEXT("Graph::GetNeighbors - Waypoint %s not found in Nodes map!"), *Waypoint->GetName());
-        return Result;
+        float Priority;
+        int32 Node;
+    };
+
+    struct FOpenEntryLess
+    {
+        bool operator()(const FOpenEntry& A, const FOpenEntry& B) const { return A.Priority < B.Priority; }
+    };
+}
+
+void AGraph::ComputeCostToFinish()
+{
+    const int32 NumNodes = BakedNodes.Num();
+    CostToFinish.Init(TNumericLimits<float>::Max(), NumNodes);
+
+    const FGraphNode* Finish = FinishNode ? Nodes.Get(FinishNode) : nullptr;
+    if (!Finish || !BakedNodes.IsValidIndex(Finish->BakedIndex))
+    {
+        return;
     }
 
-    TNode<AActor*>* Current = Node->Neighbors.GetHead();
-    while (Current)
+    // Reverse the CSR arrays so Dijkstra can run outwards from the finish along incoming edges
+    const int32 NumEdges = EdgeTargetIndices.Num();
+    TArray<int32> InOffsets;
+    InOffsets.Init(0, NumNodes + 1);
+    for (int32 Target : EdgeTargetIndices)
     {
-        if (Current->Data && Current->Data->IsValidLowLevel() && !PendingRemoval.Contains(Current->Data))
+        InOffsets[Target + 1]++;
+    }
+    for (int32 i = 0; i < NumNodes; i++)
+    {
+        InOffsets[i + 1] += InOffsets[i];
+    }
+
+    TArray<int32> InSources;
+    TArray<float> InCosts;
+    InSources.SetNumUninitialized(NumEdges);
+    InCosts.SetNumUninitialized(NumEdges);
+    TArray<int32> Fill(InOffsets.GetData(), NumNodes);
+    for (int32 Source = 0; Source < NumNodes; Source++)
+    {
+        for (int32 Edge = EdgeOffsets[Source]; Edge < EdgeOffsets[Source + 1]; Edge++)
+        {
+            const int32 Slot = Fill[EdgeTargetIndices[Edge]]++;
+            InSources[Slot] = Source;
+            InCosts[Slot] = EdgeCosts[Edge];
+        }
+    }
+
+    TArray<FOpenEntry> Open;
+    CostToFinish[Finish->BakedIndex] = 0.0f;
+    Open.HeapPush({ 0.0f, Finish->BakedIndex }, FOpenEntryLess());
+    while (Open.Num() > 0)
+    {
+        FOpenEntry Current;
+        Open.HeapPop(Current, FOpenEntryLess());
+        if (Current.Priority > CostToFinish[Current.Node])
         {
-            Result.Add(Current->Data);
+            continue; // stale entry
         }
-        else
+        for (int32 Edge = InOffsets[Current.Node]; Edge < InOffsets[Current.Node + 1]; Edge++)
         {
-            UE_LOG(LogTemp, Warning, TEXT("Graph::GetNeighbors - Invalid or pending removal neighbor in %s"), *Waypoint->GetName());
+            const int32 Source = InSources[Edge];
+            const float NewCost = Current.Priority + InCosts[Edge];
+            if (NewCost < CostToFinish[Source])
+            {
+                CostToFinish[Source] = NewCost;
+                Open.HeapPush({ NewCost, Source }, FOpenEntryLess());
+            }
         }
-        Current = Current->Next;
     }
+}
+
+bool AGraph::FindPath(AActor* Start, AActor* Goal, TArray<AActor*>& OutPath)
+{
+    OutPath.Reset();
+
+    const int32 StartIndex = GetBakedIndex(Start);
+    const int32 GoalIndex = GetBakedIndex(Goal);
+    if (StartIndex == INDEX_NONE || GoalIndex == INDEX_NONE)
+    {
+        GADE_LOG_RATE_LIMITED(LogGADERaceNav, Warning, 1.0, TEXT("Graph::FindPath - Start or goal waypoint is not in the graph"));
+        return false;
+    }
+
+    const int32 NumNodes = BakedNodes.Num();
+    const FVector GoalLocation = BakedLocations[GoalIndex];
+    TArray<float> CostSoFar;
+    TArray<int32> CameFrom;
+    CostSoFar.Init(TNumericLimits<float>::Max(), NumNodes);
+    CameFrom.Init(INDEX_NONE, NumNodes);
 
-    return Result;
+    TArray<FOpenEntry> Open;
+    CostSoFar[StartIndex] = 0.0f;
+    const float StartPriority = HeuristicScale * FVector::Dist(BakedLocations[StartIndex], GoalLocation);
+    Open.HeapPush({ StartPriority, StartIndex }, FOpenEntryLess());
+    while (Open.Num() > 0)
+    {
+        FOpenEntry Current;
+        Open.HeapPop(Current, FOpenEntryLess());
+        if (Current.Node == GoalIndex)
+        {
+            break;
+        }
+        for (int32 Edge = EdgeOffsets[Current.Node]; Edge < EdgeOffsets[Current.Node + 1]; Edge++)
+        {
+            const int32 Next = EdgeTargetIndices[Edge];
+            const float NewCost = CostSoFar[Current.Node] + EdgeCosts[Edge];
+            if (NewCost < CostSoFar[Next])
+            {
+                CostSoFar[Next] = NewCost;
+                CameFrom[Next] = Current.Node;
+                const float Priority = NewCost + HeuristicScale * FVector::Dist(BakedLocations[Next], GoalLocation);
+                Open.HeapPush({ Priority, Next }, FOpenEntryLess());
+            }
+        }
+    }
+
+    if (StartIndex != GoalIndex && CameFrom[GoalIndex] == INDEX_NONE)
+    {
+        return false;
+    }
+
+    for (int32 Node = GoalIndex; Node != INDEX_NONE; Node = CameFrom[Node])
+    {
+        OutPath.Add(BakedNodes[Node]);
+    }
+    Algo::Reverse(OutPath);
+    return true;
+}
+
+void AGraph::SetFinishNode(AActor* Finish)
+{
+    FinishNode = Finish;
+    if (bBaked)
+    {
+        ComputeCostToFinish();
+    }
+}
+
+float AGraph::GetCostToFinish(AActor* Waypoint)
+{
+    const int32 Index = GetBakedIndex(Waypoint);
+    if (Index == INDEX_NONE || CostToFinish[Index] == TNumericLimits<float>::Max())
+    {
+        return -1.0f;
+    }
+    return CostToFinish[Index];
+}
+
+AActor* AGraph::GetBestNextWaypoint(AActor* Waypoint)
+{
+    const int32 Index = GetBakedIndex(Waypoint);
+    if (Index == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    AActor* Best = nullptr;
+    float BestCost = TNumericLimits<float>::Max();
+    for (int32 Edge = EdgeOffsets[Index]; Edge < EdgeOffsets[Index + 1]; Edge++)
+    {
+        const float ToGo = CostToFinish[EdgeTargetIndices[Edge]];
+        if (ToGo == TNumericLimits<float>::Max())
+        {
+            continue;
+        }
+        const float Cost = EdgeCosts[Edge] + ToGo;
+        if (Cost < BestCost)
+        {
+            BestCost = Cost;
+            Best = EdgeTargets[Edge];
+        }
+    }
+    return Best;
 }
 
 TArray<AActor*> AGraph::GetAllKeys(TArray<AActor*>& OutWaypoints)
@@ -113,13 +449,14 @@ void AGraph::RemoveNode(AActor* Waypoint)
 {
     if (!Waypoint || !Waypoint->IsValidLowLevel())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Graph::RemoveNode - Invalid or null waypoint"));
+        UE_LOG(LogGADERaceNav, Warning, TEXT("Graph::RemoveNode - Invalid or null waypoint"));
         return;
     }
 
     PendingRemoval.Add(Waypoint);
     Nodes.Remove(Waypoint);
-    UE_LOG(LogTemp, Log, TEXT("Graph::RemoveNode - Removed waypoint: %s from Nodes map"), *Waypoint->GetName());
+    Unbake();
+    UE_LOG(LogGADERaceNav, Log, TEXT("Graph::RemoveNode - Removed waypoint: %s from Nodes map"), *Waypoint->GetName());
 
     TArray<AActor*> AllKeys;
     Nodes.GetAllKeys(AllKeys);
@@ -130,12 +467,12 @@ void AGraph::RemoveNode(AActor* Waypoint)
             if (FGraphNode* Node = Nodes.Get(Key))
             {
                 int32 OldCount = Node->Neighbors.GetCount();
-                Node->Neighbors.Remove([this, Waypoint](const AActor* N) {
-                    return N && N->IsValidLowLevel() && N == Waypoint;
+                Node->Neighbors.Remove([Waypoint](const FGraphEdge& Edge) {
+                    return Edge.To == Waypoint;
                     });
                 if (Node->Neighbors.GetCount() < OldCount)
                 {
-                    UE_LOG(LogTemp, Log, TEXT("Graph::RemoveNode - Removed %s from %s's Neighbors list"),
+                    UE_LOG(LogGADERaceNav, Verbose, TEXT("Graph::RemoveNode - Removed %s from %s's Neighbors list"),
                         *Waypoint->GetName(), *Key->GetName());
                 }
             }
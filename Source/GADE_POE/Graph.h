@@ -2,18 +2,38 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "TempHashMap.h"
+#include "TempLinkedList.h"
 #include "Graph.generated.h"
 
+/** Edge description for AGraph::BuildGraph */
+struct FGraphEdgeInit
+{
+    AActor* From;
+    AActor* To;
+    float Cost; // negative to use the distance between the two waypoints
+};
+
+/** Directed edge in a node's adjacency list */
+struct FGraphEdge
+{
+    AActor* To; // destination waypoint
+    float Cost; // traversal cost, the straight-line distance unless set explicitly
+
+    FGraphEdge() : To(nullptr), Cost(0.0f) {}
+    FGraphEdge(AActor* InTo, float InCost) : To(InTo), Cost(InCost) {}
+};
+
 USTRUCT()
 struct FGraphNode
 {
     GENERATED_BODY()
     UPROPERTY()
     AActor* Waypoint;
-    TempLinkedList<AActor*> Neighbors;
+    TempLinkedList<FGraphEdge> Neighbors;
+    int32 BakedIndex; // dense index into the baked CSR arrays, INDEX_NONE until baked
 
-    FGraphNode() : Waypoint(nullptr) {}
-    FGraphNode(AActor* InWaypoint) : Waypoint(InWaypoint) {}
+    FGraphNode() : Waypoint(nullptr), BakedIndex(INDEX_NONE) {}
+    FGraphNode(AActor* InWaypoint) : Waypoint(InWaypoint), BakedIndex(INDEX_NONE) {}
 };
 
 UCLASS()
@@ -26,9 +46,13 @@ public:
     UFUNCTION(BlueprintCallable)
     void AddNode(AActor* Waypoint);
 
+    /** Adds an edge whose cost is the distance between the two waypoints */
     UFUNCTION(BlueprintCallable)
     void AddEdge(AActor* From, AActor* To);
 
+    UFUNCTION(BlueprintCallable)
+    void AddWeightedEdge(AActor* From, AActor* To, float Cost);
+
     UFUNCTION(BlueprintCallable)
     TArray<AActor*> GetNeighbors(AActor* Waypoint);
 
@@ -38,7 +62,60 @@ public:
     UFUNCTION(BlueprintCallable)
     void RemoveNode(AActor* Waypoint);
 
+    /** Replaces the whole graph in one pass and bakes it. Logs one summary line instead of one per edge. */
+    void BuildGraph(const TArray<AActor*>& InNodes, const TArray<FGraphEdgeInit>& InEdges);
+
+    /** Freezes the adjacency lists into contiguous CSR arrays for allocation-free neighbour queries */
+    UFUNCTION(BlueprintCallable)
+    void Bake();
+
+    UFUNCTION(BlueprintCallable)
+    bool IsBaked() const { return bBaked; }
+
+    /** Zero-allocation neighbour view backed by the baked arrays. Re-bakes first if the graph changed. */
+    TArrayView<AActor* const> GetNeighborsView(AActor* Waypoint);
+
+    /** Registry IDs of the waypoints reachable from the waypoint with WaypointId, from the baked arrays */
+    TArrayView<const int32> GetNeighborIdsView(int32 WaypointId);
+
+    /** A* shortest path from Start to Goal (inclusive). Returns false if Goal is unreachable. */
+    UFUNCTION(BlueprintCallable)
+    bool FindPath(AActor* Start, AActor* Goal, TArray<AActor*>& OutPath);
+
+    /** Sets the finish line waypoint that the cost-to-finish table is measured against */
+    UFUNCTION(BlueprintCallable)
+    void SetFinishNode(AActor* Finish);
+
+    /** Shortest path cost from Waypoint to the finish node, or -1 if it can't reach it */
+    UFUNCTION(BlueprintCallable)
+    float GetCostToFinish(AActor* Waypoint);
+
+    /** Neighbour minimising edge cost plus cost-to-finish, nullptr if Waypoint has no way to the finish */
+    UFUNCTION(BlueprintCallable)
+    AActor* GetBestNextWaypoint(AActor* Waypoint);
+
 private:
     TempHashMap<AActor*, FGraphNode> Nodes;
     TSet<AActor*> PendingRemoval; // Track waypoints being removed
+
+    // Baked CSR adjacency: neighbours of node i are EdgeTargets[EdgeOffsets[i] .. EdgeOffsets[i + 1])
+    TArray<AActor*> BakedNodes;
+    TArray<FVector> BakedLocations;
+    TArray<int32> EdgeOffsets;
+    TArray<AActor*> EdgeTargets;
+    TArray<int32> EdgeTargetIndices;
+    TArray<int32> EdgeTargetIds; // registry ID of each edge target, INDEX_NONE for non-waypoint actors
+    TArray<int32> BakedIndexById; // registry ID -> baked index, so registered waypoints skip the pointer hash
+    TArray<float> EdgeCosts;
+    TArray<float> CostToFinish; // per baked node, recomputed on every bake
+    float HeuristicScale = 1.0f; // keeps the A* distance heuristic admissible when costs are set explicitly
+    bool bBaked = false;
+
+    UPROPERTY()
+    AActor* FinishNode = nullptr;
+
+    void Unbake() { bBaked = false; }
+    int32 GetBakedIndex(AActor* Waypoint); // bakes if needed, INDEX_NONE when the waypoint isn't in the graph
+    int32 GetBakedIndexById(int32 WaypointId);
+    void ComputeCostToFinish();
 };
\ No newline at end of file
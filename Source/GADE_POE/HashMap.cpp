@@ -2,7 +2,7 @@
 
 UHashMap::UHashMap()
 {
-    Table.SetNum(TableSize); // Initialize 2D array
+    Table.SetNum(InitialTableSize); // Initialize 2D array
     Size = 0;
 }
 
@@ -11,63 +11,88 @@ UHashMap::~UHashMap()
     // No manual deletion needed; TArray handles cleanup
 }
 
-uint32 UHashMap::Hash(const FString& Key) const
+uint32 UHashMap::Hash(const FString& Key)
 {
-    uint32 Hash = 0;
-    for (const TCHAR* Char = *Key; *Char; ++Char)
+    // Case-insensitive, the same as FString's == used to match keys
+    return GetTypeHash(Key);
+}
+
+const FHashMapEntry* UHashMap::FindEntry(const FString& Key, uint32 KeyHash) const
+{
+    const TArray<FHashMapEntry>& Chain = Table[KeyHash & (Table.Num() - 1)];
+    for (const FHashMapEntry& Entry : Chain)
     {
-        Hash = (Hash * 31) + (*Char - 'A'); // Case-insensitive basic hash
+        if (Entry.KeyHash == KeyHash && Entry.Key == Key)
+        {
+            return &Entry;
+        }
     }
-    return Hash % TableSize;
+    return nullptr;
 }
 
-void UHashMap::Add(const FString& Key, USoundBase* Value)
+int32 UHashMap::Add(const FString& Key, USoundBase* Value)
 {
-    uint32 Index = Hash(Key);
-    TArray<FHashMapEntry>& Chain = Table[Index];
+    const uint32 KeyHash = Hash(Key);
 
     // Check for existing key to update or append
-    for (FHashMapEntry& Entry : Chain)
+    if (const FHashMapEntry* Existing = FindEntry(Key, KeyHash))
     {
-        if (Entry.Key == Key)
-        {
-            Entry.Value = Value; // Update existing value
-            return;
-        }
+        Values[Existing->ValueIndex] = Value; // Update existing value
+        return Existing->ValueIndex;
     }
 
     // Add new entry
-    Chain.Add(FHashMapEntry(Key, Value));
+    const int32 ValueIndex = Values.Add(Value);
+    Table[KeyHash & (Table.Num() - 1)].Add(FHashMapEntry(Key, KeyHash, ValueIndex));
     Size++;
+
+    if (Size > Table.Num())
+    {
+        Grow();
+    }
+    return ValueIndex;
 }
 
 USoundBase* UHashMap::Get(const FString& Key)
 {
-    uint32 Index = Hash(Key);
-    const TArray<FHashMapEntry>& Chain = Table[Index];
+    return GetAt(FindIndex(Key));
+}
 
-    for (const FHashMapEntry& Entry : Chain)
-    {
-        if (Entry.Key == Key)
-        {
-            return Entry.Value.Get(); // Return raw pointer from weak ptr
-        }
-    }
-    return nullptr;
+int32 UHashMap::FindIndex(const FString& Key) const
+{
+    const FHashMapEntry* Entry = FindEntry(Key, Hash(Key));
+    return Entry ? Entry->ValueIndex : INDEX_NONE;
 }
 
 void UHashMap::Remove(const FString& Key)
 {
-    uint32 Index = Hash(Key);
-    TArray<FHashMapEntry>& Chain = Table[Index];
+    const uint32 KeyHash = Hash(Key);
+    TArray<FHashMapEntry>& Chain = Table[KeyHash & (Table.Num() - 1)];
 
     for (int32 i = 0; i < Chain.Num(); ++i)
     {
-        if (Chain[i].Key == Key)
+        if (Chain[i].KeyHash == KeyHash && Chain[i].Key == Key)
         {
-            Chain.RemoveAt(i);
+            // The slot is retired rather than reused, so slots handed out earlier never point at another key
+            Values[Chain[i].ValueIndex] = nullptr;
+            Chain.RemoveAtSwap(i);
             Size--;
             return;
         }
     }
-}
\ No newline at end of file
+}
+
+void UHashMap::Grow()
+{
+    TArray<TArray<FHashMapEntry>> OldTable = MoveTemp(Table);
+    Table.SetNum(OldTable.Num() * 2);
+
+    // Stored hashes mean no key is hashed again
+    for (TArray<FHashMapEntry>& Chain : OldTable)
+    {
+        for (FHashMapEntry& Entry : Chain)
+        {
+            Table[Entry.KeyHash & (Table.Num() - 1)].Add(MoveTemp(Entry));
+        }
+    }
+}
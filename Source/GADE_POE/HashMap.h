@@ -8,10 +8,11 @@
 struct FHashMapEntry
 {
     FString Key;
-    TWeakObjectPtr<USoundBase> Value; // Use weak pointer for UObjects
+    uint32 KeyHash; // full hash, compared before the string and reused when the table grows
+    int32 ValueIndex; // slot in UHashMap::Values, stable while the key is in the map
 
-    FHashMapEntry() {}
-    FHashMapEntry(const FString& K, USoundBase* V) : Key(K), Value(V) {}
+    FHashMapEntry() : KeyHash(0), ValueIndex(INDEX_NONE) {}
+    FHashMapEntry(const FString& K, uint32 H, int32 I) : Key(K), KeyHash(H), ValueIndex(I) {}
 };
 
 UCLASS()
@@ -23,15 +24,37 @@ public:
     UHashMap();
     virtual ~UHashMap();
 
-    void Add(const FString& Key, USoundBase* Value);
+    /** Adds or updates Key and returns its slot, which doesn't change until Key is removed */
+    int32 Add(const FString& Key, USoundBase* Value);
     USoundBase* Get(const FString& Key);
     void Remove(const FString& Key);
     int32 GetSize() const { return Size; }
 
+    /** Slot of Key, or INDEX_NONE. Resolve once and keep the slot for GetAt. */
+    int32 FindIndex(const FString& Key) const;
+
+    /** Replaces the value in a slot, e.g. once its sound has streamed in */
+    void SetAt(int32 Index, USoundBase* Value)
+    {
+        if (Values.IsValidIndex(Index))
+        {
+            Values[Index] = Value;
+        }
+    }
+
+    /** Lookup by slot, no hashing or string compares */
+    USoundBase* GetAt(int32 Index) const
+    {
+        return Values.IsValidIndex(Index) ? Values[Index].Get() : nullptr;
+    }
+
 private:
-    TArray<TArray<FHashMapEntry>> Table; // 2D array for chaining
+    TArray<TArray<FHashMapEntry>> Table; // 2D array for chaining, the size is always a power of two
+    TArray<TWeakObjectPtr<USoundBase>> Values; // Use weak pointer for UObjects, indexed by slot
     int32 Size;
-    static const int32 TableSize = 16;
+    static const int32 InitialTableSize = 16;
 
-    uint32 Hash(const FString& Key) const;
-};
\ No newline at end of file
+    static uint32 Hash(const FString& Key);
+    const FHashMapEntry* FindEntry(const FString& Key, uint32 KeyHash) const;
+    void Grow(); // doubles the bucket count once chains average more than one entry
+};
@@ -3,8 +3,19 @@
 
 #include "MainMenu_GMB.h"
 
+AMainMenu_GMB::AMainMenu_GMB()
+{
+	// The menu only needs its UI sounds
+	SoundPreloadSet.BuiltinSounds = { ESFXSound::ButtonClick, ESFXSound::ButtonHover, ESFXSound::MenuOpen, ESFXSound::MenuClose };
+}
+
 void AMainMenu_GMB::BeginPlay()
 {
+	// Stream the menu sounds in while the menu opens
+	if (ASFXManager* SFXManager = ASFXManager::GetInstance(GetWorld()))
+	{
+		SFXManager->PreloadSounds(SoundPreloadSet);
+	}
 
 	if (MainMenuClass)
 	{
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "Blueprint/UserWidget.h"
+#include "SFXManager.h"
 #include "MainMenu_GMB.generated.h"
 
 /**
@@ -16,11 +17,17 @@ class GADE_POE_API AMainMenu_GMB : public AGameModeBase
 	GENERATED_BODY()
 
 public:
+	AMainMenu_GMB();
+
 	virtual void BeginPlay() override;
 
 	UPROPERTY(EditDefaultsOnly, Category = "UI")
 	TSubclassOf<UUserWidget> MainMenuClass;
 
+	// Sounds streamed in when the level starts, so their first play doesn't wait on a load
+	UPROPERTY(EditDefaultsOnly, Category = "Audio")
+	FSFXPreloadSet SoundPreloadSet;
+
 private:
 	UUserWidget* CurrentWidget;
 	
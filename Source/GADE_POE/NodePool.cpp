@@ -0,0 +1,5 @@
+#include "NodePool.h"
+
+DEFINE_STAT(STAT_PooledNodesLive);
+DEFINE_STAT(STAT_PooledNodeCapacity);
+DEFINE_STAT(STAT_NodePoolSlabAllocations);
@@ -0,0 +1,173 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("GADE Containers"), STATGROUP_GADEContainers, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Nodes Live"), STAT_PooledNodesLive, STATGROUP_GADEContainers, GADE_POE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Node Capacity"), STAT_PooledNodeCapacity, STATGROUP_GADEContainers, GADE_POE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Node Pool Slab Allocations"), STAT_NodePoolSlabAllocations, STATGROUP_GADEContainers, GADE_POE_API);
+
+/** Allocation counters for one node pool */
+struct FNodePoolStats
+{
+    int32 SlabAllocations = 0; // heap allocations the pool has made
+    int32 NodesAcquired = 0; // total Acquire calls
+    int32 NodesRecycled = 0; // Acquire calls served from the free list
+    int32 LiveNodes = 0;
+    int32 Capacity = 0; // nodes the pool can hold without allocating again
+};
+
+/**
+ * Slab allocator for the linked containers' nodes.
+ * Nodes are carved out of slabs that double in size, and released nodes go on a free list
+ * that Acquire takes from first, so a container that keeps emptying and refilling stops
+ * hitting the heap after the first fill. Slabs are only freed in bulk, by ReleaseAll or
+ * when the pool is destroyed. A pool can be owned by one container or shared as an arena
+ * by several containers of the same node type.
+ */
+template<typename NodeType>
+class TNodePool
+{
+public:
+    TNodePool() = default;
+
+    ~TNodePool()
+    {
+        ReleaseAll();
+    }
+
+    TNodePool(const TNodePool&) = delete;
+    TNodePool& operator=(const TNodePool&) = delete;
+
+    // Slabs are heap blocks, so moving the pool keeps every node and free list pointer valid
+    TNodePool(TNodePool&& Other)
+        : Slabs(MoveTemp(Other.Slabs)), FreeList(Other.FreeList), SlabUsed(Other.SlabUsed), SlabCapacity(Other.SlabCapacity), Stats(Other.Stats)
+    {
+        Other.ResetState();
+    }
+
+    TNodePool& operator=(TNodePool&& Other)
+    {
+        if (this != &Other)
+        {
+            ReleaseAll();
+            Slabs = MoveTemp(Other.Slabs);
+            FreeList = Other.FreeList;
+            SlabUsed = Other.SlabUsed;
+            SlabCapacity = Other.SlabCapacity;
+            Stats = Other.Stats;
+            Other.ResetState();
+        }
+        return *this;
+    }
+
+    template<typename... ArgTypes>
+    NodeType* Acquire(ArgTypes&&... Args)
+    {
+        void* Memory;
+        if (FreeList)
+        {
+            Memory = FreeList;
+            FreeList = FreeList->Next;
+            Stats.NodesRecycled++;
+        }
+        else
+        {
+            if (SlabUsed == SlabCapacity)
+            {
+                AllocateSlab(FMath::Clamp(SlabCapacity * 2, MinSlabNodes, MaxSlabNodes));
+            }
+            Memory = &Slabs.Last()[SlabUsed++];
+        }
+
+        Stats.NodesAcquired++;
+        Stats.LiveNodes++;
+        INC_DWORD_STAT(STAT_PooledNodesLive);
+        return new (Memory) NodeType(Forward<ArgTypes>(Args)...);
+    }
+
+    void Release(NodeType* Node)
+    {
+        if (!Node)
+        {
+            return;
+        }
+
+        Node->~NodeType();
+        FSlot* Slot = reinterpret_cast<FSlot*>(Node);
+        Slot->Next = FreeList;
+        FreeList = Slot;
+        Stats.LiveNodes--;
+        DEC_DWORD_STAT(STAT_PooledNodesLive);
+    }
+
+    /** Makes sure at least NumNodes more nodes can be acquired without a heap allocation */
+    void Reserve(int32 NumNodes)
+    {
+        const int32 Free = Stats.Capacity - Stats.LiveNodes;
+        if (NumNodes > Free)
+        {
+            AllocateSlab(NumNodes - Free);
+        }
+    }
+
+    /** Frees every slab at once. Only valid when no node is live, which the owning containers guarantee by clearing first. */
+    void ReleaseAll()
+    {
+        check(Stats.LiveNodes == 0);
+        DEC_DWORD_STAT_BY(STAT_PooledNodeCapacity, Stats.Capacity);
+        Slabs.Empty();
+        FreeList = nullptr;
+        SlabUsed = 0;
+        SlabCapacity = 0;
+        Stats.Capacity = 0;
+    }
+
+    const FNodePoolStats& GetStats() const { return Stats; }
+
+private:
+    union FSlot
+    {
+        FSlot* Next; // while the slot is on the free list
+        TTypeCompatibleBytes<NodeType> Storage; // while a node lives in it
+    };
+
+    static constexpr int32 MinSlabNodes = 4;
+    static constexpr int32 MaxSlabNodes = 256;
+
+    TArray<TUniquePtr<FSlot[]>> Slabs;
+    FSlot* FreeList = nullptr;
+    int32 SlabUsed = 0; // slots handed out from the newest slab
+    int32 SlabCapacity = 0; // size of the newest slab
+    FNodePoolStats Stats;
+
+    void AllocateSlab(int32 NumNodes)
+    {
+        // Whatever is left of the current slab goes on the free list so it isn't stranded
+        if (Slabs.Num() > 0)
+        {
+            for (int32 i = SlabUsed; i < SlabCapacity; i++)
+            {
+                FSlot* Slot = &Slabs.Last()[i];
+                Slot->Next = FreeList;
+                FreeList = Slot;
+            }
+        }
+
+        Slabs.Add(TUniquePtr<FSlot[]>(new FSlot[NumNodes]));
+        SlabUsed = 0;
+        SlabCapacity = NumNodes;
+        Stats.SlabAllocations++;
+        Stats.Capacity += NumNodes;
+        INC_DWORD_STAT(STAT_NodePoolSlabAllocations);
+        INC_DWORD_STAT_BY(STAT_PooledNodeCapacity, NumNodes);
+    }
+
+    void ResetState()
+    {
+        FreeList = nullptr;
+        SlabUsed = 0;
+        SlabCapacity = 0;
+        Stats = FNodePoolStats();
+    }
+};
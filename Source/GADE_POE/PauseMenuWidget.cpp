@@ -109,11 +109,10 @@ void UPauseMenuWidget::UpdateLeaderboard()
 	// Update the leaderboard text 
     if (GameState && LeaderboardText)
     {
-        TArray<FRacerLeaderboardEntry> Rankings = GameState->GetLeaderboard();
         FString LeaderboardString = TEXT("Leaderboard:\n");
-        for (const FRacerLeaderboardEntry& Entry : Rankings)
+        for (const FRacerLeaderboardEntry& Entry : GameState->GetLeaderboardView())
         {
-            LeaderboardString += FString::Printf(TEXT("%d. %s (Lap %d, Waypoint %d)\n"),
+            LeaderboardString.Appendf(TEXT("%d. %s (Lap %d, Waypoint %d)\n"),
                 Entry.Placement, *Entry.RacerName, Entry.Lap, Entry.WaypointIndex);
         }
         LeaderboardText->SetText(FText::FromString(LeaderboardString));
@@ -1,4 +1,5 @@
 ﻿#include "PlayerHamster.h"
+#include "GADE_POE.h"
 #include "Components/StaticMeshComponent.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -11,10 +12,11 @@
 #include "BiginnerRaceGameState.h"
 #include "BeginnerRaceHUD.h"
 #include "DrawDebugHelpers.h"
-#include "Components/SphereComponent.h"
 #include "SFXManager.h"
 #include "AdvancedRaceManager.h"
 #include "Graph.h"
+#include "RaceWorldSubsystem.h"
+#include "WaypointArrivalSubsystem.h"
 
 APlayerHamster::APlayerHamster()
 {
@@ -103,12 +105,12 @@ void APlayerHamster::BeginPlay()
         PauseMenuWidget = CreateWidget<UUserWidget>(GetWorld(), PauseMenuWidgetClass);
         if (!PauseMenuWidget)
         {
-            UE_LOG(LogTemp, Error, TEXT("PlayerHamster: Failed to create PauseMenuWidget!"));
+            UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: Failed to create PauseMenuWidget!"));
         }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: PauseMenuWidgetClass is not set in the editor!"));
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: PauseMenuWidgetClass is not set in the editor!"));
     }
 
     // Create the UI widgets for the End UI
@@ -117,12 +119,12 @@ void APlayerHamster::BeginPlay()
         EndUIWidget = CreateWidget<UUserWidget>(GetWorld(), EndUIWidgetClass);
         if (!EndUIWidget)
         {
-            UE_LOG(LogTemp, Error, TEXT("PlayerHamster: Failed to create EndUIWidget!"));
+            UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: Failed to create EndUIWidget!"));
         }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: EndUIWidgetClass is not set in the editor!"));
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: EndUIWidgetClass is not set in the editor!"));
     }
 
     // Create the HUD widget for BeginnerMap or AdvancedMap
@@ -130,7 +132,7 @@ void APlayerHamster::BeginPlay()
     {
         FString CurrentLevelName = GetWorld()->GetMapName();
         CurrentLevelName.RemoveFromStart(TEXT("UEDPIE_0_"));
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Current map name after prefix removal: %s"), *CurrentLevelName);
+        UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Current map name after prefix removal: %s"), *CurrentLevelName);
 
         bool bIsBeginnerMap = CurrentLevelName.Contains(TEXT("BeginnerMap"), ESearchCase::IgnoreCase);
         bool bIsAdvancedMap = CurrentLevelName.Contains(TEXT("AdvancedMap"), ESearchCase::IgnoreCase);
@@ -141,74 +143,63 @@ void APlayerHamster::BeginPlay()
             if (HUDWidget)
             {
                 HUDWidget->AddToViewport();
-                UE_LOG(LogTemp, Log, TEXT("PlayerHamster: HUD widget added to viewport for %s"), *CurrentLevelName);
+                UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: HUD widget added to viewport for %s"), *CurrentLevelName);
             }
             else
             {
-                UE_LOG(LogTemp, Error, TEXT("PlayerHamster: Failed to create HUD widget for %s"), *CurrentLevelName);
+                UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: Failed to create HUD widget for %s"), *CurrentLevelName);
             }
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("PlayerHamster: Map name %s does not match BeginnerMap or AdvancedMap"), *CurrentLevelName);
+            UE_LOG(LogGADERace, Warning, TEXT("PlayerHamster: Map name %s does not match BeginnerMap or AdvancedMap"), *CurrentLevelName);
         }
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: HUDClass is not set!"));
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: HUDClass is not set!"));
     }
 
-    // Set up overlap events for waypoints
-    GetCapsuleComponent()->OnComponentBeginOverlap.AddDynamic(this, &APlayerHamster::OnWaypointOverlap);
-
-    // Find the race manager
-    RaceManager = Cast<AAdvancedRaceManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AAdvancedRaceManager::StaticClass()));
-    if (RaceManager)
+    // Arrival at the current waypoint is checked centrally, SetTarget keeps it pointed at the right one
+    if (UWaypointArrivalSubsystem* Arrivals = GetWorld()->GetSubsystem<UWaypointArrivalSubsystem>())
     {
-        bUseGraphNavigation = true;
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Using graph navigation with AdvancedRaceManager"));
-    }
-    else
-    {
-        // Find waypoint manager as fallback
-        WaypointManager = Cast<AWaypointManager>(UGameplayStatics::GetActorOfClass(GetWorld(), AWaypointManager::StaticClass()));
-        if (WaypointManager)
-        {
-            UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Using waypoint manager navigation"));
-        }
+        Arrivals->RegisterRacer(this, FOnWaypointArrival::CreateUObject(this, &APlayerHamster::HandleWaypointArrival));
     }
 
     GameState = Cast<ABeginnerRaceGameState>(GetWorld()->GetGameState());
     if (!GameState)
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: GameState not found!"));
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: GameState not found!"));
     }
     else
     {
         // Register the player with the GameState
         GameState->RegisterRacer(this);
-        UE_LOG(LogTemp, Warning, TEXT("PlayerHamster: Registered with GameState"));
+        UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Registered with GameState"));
     }
 
-    // Initialize the first waypoint for tracking (but don't teleport to it)
-    AActor* FirstWaypoint = nullptr;
-    if (bUseGraphNavigation && RaceManager)
+    // Track whichever manager the level has once it is ready, the race manager wins if both are.
+    // The first waypoint is only tracked, the player isn't teleported to it.
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
     {
-        FirstWaypoint = RaceManager->GetWaypoint(0);
-    }
-    else if (WaypointManager)
-    {
-        FirstWaypoint = WaypointManager->GetWaypoint(0);
-    }
+        RaceServices->WhenServiceReady<AAdvancedRaceManager>(this, [this](AAdvancedRaceManager* Manager)
+        {
+            RaceManager = Manager;
+            bUseGraphNavigation = true;
+            UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Using graph navigation with AdvancedRaceManager"));
+            SetFirstWaypoint(RaceManager->GetWaypoint(0));
+        });
 
-    if (FirstWaypoint)
-    {
-        CurrentWaypoint = FirstWaypoint;
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: First waypoint set to %s"), *FirstWaypoint->GetName());
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: First waypoint is null"));
+        RaceServices->WhenServiceReady<AWaypointManager>(this, [this](AWaypointManager* Manager)
+        {
+            if (bUseGraphNavigation)
+            {
+                return;
+            }
+            WaypointManager = Manager;
+            UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Using waypoint manager navigation"));
+            SetFirstWaypoint(WaypointManager->GetWaypoint(0));
+        });
     }
 
     RegisterWithGameState();
@@ -224,11 +215,11 @@ void APlayerHamster::BeginPlay()
     if (SFXManager)
     {
         SFXManager->PlayBackgroundMusic("bgm");
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Started background music"));
+        UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Started background music"));
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: SFXManager is null!"));
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: SFXManager is null!"));
     }
 
     // Set initial rotation to match the model's forward direction
@@ -260,11 +251,11 @@ void APlayerHamster::Tick(float DeltaTime)
         }
         if (SFXManager)
         {
-            SFXManager->PlaySound("end");
+            SFXManager->PlaySoundById(ESFXSound::End);
             SFXManager->StopBackgroundMusic();
         }
         bEndUIShown = true;
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: End UI shown"));
+        UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: End UI shown"));
     }
 
     // Visualize waypoint choices if waiting for player input
@@ -299,65 +290,18 @@ void APlayerHamster::Tick(float DeltaTime)
             }
         }
     }
-    // Check distance to current waypoint and trigger OnWaypointReached if close enough
-    else if (!bWaitingForWaypointChoice)  // Only check distance if not waiting for choice
-    {
-    AActor* TargetWaypoint = nullptr;
-    if (bUseGraphNavigation && RaceManager && CurrentWaypoint)
-    {
-        TargetWaypoint = CurrentWaypoint;
-    }
-    else if (WaypointManager)
-    {
-        TargetWaypoint = WaypointManager->GetWaypoint(CurrentWaypointIndex);
-    }
-
-    if (TargetWaypoint)
-    {
-        FVector PlayerLocation = GetActorLocation();
-        FVector WaypointLocation = TargetWaypoint->GetActorLocation();
-        float Distance = FVector::Dist(PlayerLocation, WaypointLocation);
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Distance to waypoint %s: %f"), *TargetWaypoint->GetName(), Distance);
-
-        USphereComponent* WaypointCollision = Cast<USphereComponent>(TargetWaypoint->GetComponentByClass(USphereComponent::StaticClass()));
-        if (WaypointCollision)
-        {
-            TArray<AActor*> OverlappingActors;
-            WaypointCollision->GetOverlappingActors(OverlappingActors, APlayerHamster::StaticClass());
-            if (OverlappingActors.Contains(this))
-            {
-                OnWaypointReached(TargetWaypoint);
-            }
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("PlayerHamster: Waypoint %s lacks USphereComponent, using distance check"), *TargetWaypoint->GetName());
-            if (Distance < 5000.0f)
-            {
-                OnWaypointReached(TargetWaypoint);
-            }
-        }
 
-            // Only draw current waypoint debug sphere if not choosing
-        if (WaypointCollision)
-        {
-            float SphereRadius = WaypointCollision->GetScaledSphereRadius();
-            DrawDebugSphere(GetWorld(), WaypointLocation, SphereRadius, 12, FColor::Green, false, 0.1f);
-        }
-        else
-        {
-            DrawDebugSphere(GetWorld(), WaypointLocation, 5000.0f, 12, FColor::Red, false, 0.1f);
-        }
-    }
-    else
+    if (CurrentSpeed > 0.0f && SFXManager)
     {
-        UE_LOG(LogTemp, Warning, TEXT("PlayerHamster: TargetWaypoint is null (Index: %d)"), CurrentWaypointIndex);
-        }
+        SFXManager->PlaySoundById(ESFXSound::Engine);
     }
 
-    if (CurrentSpeed > 0.0f && SFXManager)
+    // Only tell the HUD when the value it shows would change
+    const int32 DisplayedSpeed = FMath::RoundToInt(CurrentSpeed * 10.0f);
+    if (DisplayedSpeed != LastBroadcastSpeed)
     {
-        SFXManager->PlaySound("engine");
+        LastBroadcastSpeed = DisplayedSpeed;
+        OnSpeedChanged.Broadcast(CurrentSpeed);
     }
 }
 
@@ -478,61 +422,97 @@ void APlayerHamster::RegisterWithGameState()
     }
 }
 
+void APlayerHamster::SetFirstWaypoint(AActor* FirstWaypoint)
+{
+    if (FirstWaypoint)
+    {
+        CurrentWaypoint = FirstWaypoint;
+        UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: First waypoint set to %s"), *FirstWaypoint->GetName());
+    }
+    else
+    {
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: First waypoint is null"));
+    }
+    UpdateArrivalTarget();
+}
+
+void APlayerHamster::UpdateArrivalTarget()
+{
+    // Nothing to arrive at while a branch is still being chosen
+    AActor* TargetWaypoint = nullptr;
+    if (!bWaitingForWaypointChoice)
+    {
+        if (bUseGraphNavigation && RaceManager)
+        {
+            TargetWaypoint = CurrentWaypoint;
+        }
+        else if (WaypointManager)
+        {
+            TargetWaypoint = WaypointManager->GetWaypoint(CurrentWaypointIndex);
+        }
+    }
+
+    if (UWaypointArrivalSubsystem* Arrivals = GetWorld()->GetSubsystem<UWaypointArrivalSubsystem>())
+    {
+        Arrivals->SetTarget(this, TargetWaypoint);
+    }
+}
+
 void APlayerHamster::OnWaypointReached(AActor* Waypoint)
 {
     if (!Waypoint)
     {
-        UE_LOG(LogTemp, Error, TEXT("PlayerHamster: OnWaypointReached called with null waypoint"));
+        UE_LOG(LogGADERace, Error, TEXT("PlayerHamster: OnWaypointReached called with null waypoint"));
         return;
     }
 
     ASFXManager* SFXManager = ASFXManager::GetInstance(GetWorld());
     if (SFXManager)
     {
-        SFXManager->PlaySound("waypoint");
+        SFXManager->PlaySoundById(ESFXSound::Waypoint);
     }
 
     if (bUseGraphNavigation && RaceManager)
     {
         // Advanced map - Graph-based navigation
-        for (int32 i = 0; i < RaceManager->GetTotalWaypoints(); ++i)
+        // CurrentWaypointIndex counts waypoints passed this lap, as on the beginner map and for
+        // the AI racers, which is what the game state's lap fraction expects
+        const int32 TrackIndex = RaceManager->GetTrackIndex(Waypoint);
+        const int32 NumTrackWaypoints = RaceManager->GetTotalWaypoints();
+        if (TrackIndex != INDEX_NONE && NumTrackWaypoints > 0)
         {
-            if (RaceManager->GetWaypoint(i) == Waypoint)
-            {
-                CurrentWaypointIndex = i;
-                break;
-            }
+            CurrentWaypointIndex = (TrackIndex + 1) % NumTrackWaypoints;
         }
 
         // Get next possible waypoints
         AGraph* Graph = RaceManager->GetGraph();
         if (Graph)
         {
-            TArray<AActor*> Neighbors = Graph->GetNeighbors(Waypoint);
+            TArrayView<AActor* const> Neighbors = Graph->GetNeighborsView(Waypoint);
             if (Neighbors.Num() > 0)
             {
                 CurrentWaypoint = Neighbors[0];
-                UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Moving to next waypoint %s"), *CurrentWaypoint->GetName());
+                UE_LOG(LogGADERace, Verbose, TEXT("PlayerHamster: Moving to next waypoint %s"), *CurrentWaypoint->GetName());
             }
         }
 
         // Check if we've completed a lap (when we reach waypoint 11, which connects back to 0)
-        if (CurrentWaypointIndex == 11)
+        if (TrackIndex == 11)
         {
             CurrentLap++;
             CurrentWaypointIndex = 0;
             if (SFXManager)
             {
-                SFXManager->PlaySound("lap");
+                SFXManager->PlaySoundById(ESFXSound::Lap);
             }
-            UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Completed lap %d"), CurrentLap);
+            UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Completed lap %d"), CurrentLap);
         }
     }
     else
     {
         // Beginner map - Sequential waypoints
         CurrentWaypointIndex++;
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Reached waypoint index %d"), CurrentWaypointIndex);
+        UE_LOG(LogGADERace, Verbose, TEXT("PlayerHamster: Reached waypoint index %d"), CurrentWaypointIndex);
 
         // Check if a lap is completed
         if (GameState && CurrentWaypointIndex >= GameState->TotalWaypoints)
@@ -541,9 +521,9 @@ void APlayerHamster::OnWaypointReached(AActor* Waypoint)
             CurrentWaypointIndex = 0;
             if (SFXManager)
             {
-                SFXManager->PlaySound("lap");
+                SFXManager->PlaySoundById(ESFXSound::Lap);
             }
-            UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Completed lap %d"), CurrentLap);
+            UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Completed lap %d"), CurrentLap);
         }
     }
 
@@ -551,8 +531,10 @@ void APlayerHamster::OnWaypointReached(AActor* Waypoint)
     if (GameState)
     {
         GameState->UpdateRacerProgress(this, CurrentLap, CurrentWaypointIndex);
-        UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Updated GameState - Lap: %d, WaypointIndex: %d"), CurrentLap, CurrentWaypointIndex);
+        UE_LOG(LogGADERace, Verbose, TEXT("PlayerHamster: Updated GameState - Lap: %d, WaypointIndex: %d"), CurrentLap, CurrentWaypointIndex);
     }
+
+    UpdateArrivalTarget();
 }
 
 void APlayerHamster::SelectNextWaypoint()
@@ -591,20 +573,18 @@ void APlayerHamster::ConfirmWaypoint()
     CurrentWaypoint = AvailableWaypoints[CurrentWaypointChoice];
     bWaitingForWaypointChoice = false;
     
-    // Find the index of the chosen waypoint in the RaceManager's waypoint list
+    // Heading to track index k means k waypoints passed this lap, the same count
+    // OnWaypointReached reports on arrival at the waypoint before it
     if (RaceManager)
     {
-        for (int32 i = 0; i < RaceManager->GetTotalWaypoints(); ++i)
+        const int32 TrackIndex = RaceManager->GetTrackIndex(CurrentWaypoint);
+        if (TrackIndex != INDEX_NONE)
         {
-            if (RaceManager->GetWaypoint(i) == CurrentWaypoint)
-            {
-                CurrentWaypointIndex = i;
-                break;
-            }
+            CurrentWaypointIndex = TrackIndex;
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("PlayerHamster: Confirmed waypoint choice: %s (index: %d)"), 
+    UE_LOG(LogGADERace, Verbose, TEXT("PlayerHamster: Confirmed waypoint choice: %s (index: %d)"), 
         *CurrentWaypoint->GetName(), CurrentWaypointIndex);
 
     // Update game state with new progress
@@ -612,6 +592,8 @@ void APlayerHamster::ConfirmWaypoint()
     {
         GameState->UpdateRacerProgress(this, CurrentLap, CurrentWaypointIndex);
     }
+
+    UpdateArrivalTarget();
 }
 
 void APlayerHamster::OnPhysicsBodyOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -619,20 +601,21 @@ void APlayerHamster::OnPhysicsBodyOverlapBegin(UPrimitiveComponent* OverlappedCo
     ASFXManager* SFXManager = ASFXManager::GetInstance(GetWorld());
     if (OtherActor != this && OtherActor->GetName().Contains("Racer") && SFXManager)
     {
-        SFXManager->PlaySound("crash");
-        UE_LOG(LogTemp, Warning, TEXT("PlayerHamster: Collided with AI racer: %s"), *OtherActor->GetName());
+        SFXManager->PlaySoundById(ESFXSound::Crash);
+        UE_LOG(LogGADERace, Log, TEXT("PlayerHamster: Collided with AI racer: %s"), *OtherActor->GetName());
     }
 }
 
-void APlayerHamster::OnWaypointOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void APlayerHamster::HandleWaypointArrival(AActor* Waypoint)
 {
-    if (bIsPaused) return;
-
-    AWaypoint* Waypoint = Cast<AWaypoint>(OtherActor);
-    if (!Waypoint) return;
+    if (bIsPaused)
+    {
+        UpdateArrivalTarget(); // the arrival cleared the target, keep waiting on the same one
+        return;
+    }
 
     // Log waypoint progression
-    UE_LOG(LogTemp, Warning, TEXT("PLAYER - Current Waypoint: %s"), *Waypoint->GetName());
+    UE_LOG(LogGADERace, Verbose, TEXT("PLAYER - Current Waypoint: %s"), *Waypoint->GetName());
     
     // Call OnWaypointReached to handle waypoint progression and choices
     OnWaypointReached(Waypoint);
@@ -651,12 +634,15 @@ void APlayerHamster::OnWaypointOverlap(UPrimitiveComponent* OverlappedComponent,
     if (bUseGraphNavigation && RaceManager)
     {
         // Get next waypoint options from graph and visualize them
-        TArray<AActor*> NextWaypoints = RaceManager->GetGraph()->GetNeighbors(Waypoint);
+        TArrayView<AActor* const> NextWaypoints = RaceManager->GetGraph()->GetNeighborsView(Waypoint);
         
         FString NextOptionsStr;
         for (AActor* Next : NextWaypoints)
         {
-            NextOptionsStr += FString::Printf(TEXT("%s, "), *Next->GetName());
+            if (UE_LOG_ACTIVE(LogGADERace, Verbose))
+            {
+                NextOptionsStr += FString::Printf(TEXT("%s, "), *Next->GetName());
+            }
             
             // Visualize available next waypoints
             DrawDebugSphere(
@@ -682,19 +668,16 @@ void APlayerHamster::OnWaypointOverlap(UPrimitiveComponent* OverlappedComponent,
             );
         }
         
-        UE_LOG(LogTemp, Warning, TEXT("PLAYER - Next Possible Waypoints: %s"), *NextOptionsStr);
+        UE_LOG(LogGADERace, Verbose, TEXT("PLAYER - Next Possible Waypoints: %s"), *NextOptionsStr);
     }
     else if (WaypointManager && WaypointManager->WaypointList)
     {
         AActor* NextWaypoint = WaypointManager->WaypointList->GetNext(Waypoint);
         if (NextWaypoint)
         {
-            UE_LOG(LogTemp, Warning, TEXT("PLAYER - Next Waypoint: %s"), *NextWaypoint->GetName());
+            UE_LOG(LogGADERace, Verbose, TEXT("PLAYER - Next Waypoint: %s"), *NextWaypoint->GetName());
         }
     }
-
-    // Update current waypoint
-    CurrentWaypoint = Waypoint;
 }
 
 void APlayerHamster::SetSpeed(float NewSpeed)
@@ -19,6 +19,8 @@ class ABeginnerRaceGameState;
 class AWaypointManager;
 class AAdvancedRaceManager;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerSpeedChanged, float, Speed);
+
 UCLASS()
 class GADE_POE_API APlayerHamster : public ACharacter
 {
@@ -49,6 +51,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Movement")
     float GetMaxSpeed() const { return MaxSpeed; }
 
+    /** Fired from Tick when the speed changes by at least the HUD's 0.1 display step */
+    UPROPERTY(BlueprintAssignable, Category = "Movement")
+    FOnPlayerSpeedChanged OnSpeedChanged;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spline")
     USplineComponent* Spline;
 
@@ -133,6 +139,8 @@ protected:
     UPROPERTY()
     bool bEndUIShown;
 
+    int32 LastBroadcastSpeed = INDEX_NONE; // speed in tenths at the last OnSpeedChanged
+
     UPROPERTY()
     AWaypointManager* WaypointManager;
 
@@ -157,11 +165,13 @@ protected:
     float MoveDirection = 0.0f;
 
     void RegisterWithGameState();
+    void SetFirstWaypoint(AActor* FirstWaypoint);
+    void UpdateArrivalTarget(); // points the arrival check at the waypoint the player is heading for
     void OnWaypointReached(AActor* Waypoint);
 
     UFUNCTION()
     void OnPhysicsBodyOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
-    UFUNCTION()
-    void OnWaypointOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+    /** Called by UWaypointArrivalSubsystem when the player reaches its current waypoint */
+    void HandleWaypointArrival(AActor* Waypoint);
 };
\ No newline at end of file
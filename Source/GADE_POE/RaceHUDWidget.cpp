@@ -2,7 +2,7 @@
 #include "Components/TextBlock.h"
 #include "PlayerHamster.h"
 #include "CheckpointManager.h"
-#include "EngineUtils.h"
+#include "RaceWorldSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 void URaceHUDWidget::SetRaceStats(float Speed, float TimeElapsed, int32 CurrentLap, int32 TotalLaps)
 {
@@ -23,65 +23,122 @@ void URaceHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
     }
 	ElapsedTime += InDeltaTime;
 
+    RefreshDirtyText();
+}
+
+void URaceHUDWidget::RefreshDirtyText()
+{
+    // The clock only shows whole seconds
+    const int32 ElapsedSeconds = FMath::FloorToInt(ElapsedTime);
+    if (ElapsedSeconds != DisplayedElapsedSeconds)
+    {
+        DisplayedElapsedSeconds = ElapsedSeconds;
+        TimeText = FText::FromString(FString::Printf(TEXT("Time: %02d:%02d"), ElapsedSeconds / 60, ElapsedSeconds % 60));
+    }
+
+    if (bSpeedDirty)
+    {
+        bSpeedDirty = false;
+        const float Speed = PlayerHamsterClass ? PlayerHamsterClass->GetSpeed() : 0.0f;
+        SpeedText = PlayerHamsterClass
+            ? FText::FromString(FString::Printf(TEXT("Speed: %.1f km/h"), Speed))
+            : FText::FromString(TEXT("Speed: 0 km/h"));
+    }
+
+    if (bLapDirty)
+    {
+        bLapDirty = false;
+        if (CheckpointManagerClass)
+        {
+            LapText = FText::FromString(FString::Printf(TEXT("Lap %d/%d \n Checkpoints Left: %d"),
+                CheckpointManagerClass->GetCurrentLap(), CheckpointManagerClass->GetTotalLaps(), CheckpointManagerClass->GetRemainingCheckpoint()));
+        }
+        else
+        {
+            LapText = FText::FromString(TEXT("Lap 0/0 | Checkpoints Left: 0"));
+        }
+    }
+
+    if (bRemainingTimeDirty)
+    {
+        bRemainingTimeDirty = false;
+        const int32 RemainingSeconds = CheckpointManagerClass ? FMath::FloorToInt(FMath::Max(CheckpointManagerClass->GetRemainingTime(), 0.0f)) : 0;
+        RemainingTimeText = FText::FromString(FString::Printf(TEXT("Remaining Time: %02d:%02d"), RemainingSeconds / 60, RemainingSeconds % 60));
+    }
+}
+
+void URaceHUDWidget::HandleSpeedChanged(float Speed)
+{
+    bSpeedDirty = true;
+}
+
+void URaceHUDWidget::HandleCheckpointProgressChanged()
+{
+    bLapDirty = true;
+}
+
+void URaceHUDWidget::HandleRemainingTimeChanged(int32 RemainingSeconds)
+{
+    bRemainingTimeDirty = true;
 }
 
 void URaceHUDWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
-    for(TActorIterator<ACheckpointManager> It(GetWorld()); It; ++It) // Find CheckpointManager in the level
-	{
-		CheckpointManagerClass = *It;
-        break;
-	}
-
-	for (TActorIterator<APlayerHamster> It(GetWorld()); It; ++It) // Find PlayerHamster in the level
-	{
-		PlayerHamsterClass = *It;
-		break;
-	}
+	PlayerHamsterClass = Cast<APlayerHamster>(GetOwningPlayerPawn()); // The hamster this HUD belongs to
+
+    // Text is rebuilt only when these fire, not every frame
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->WhenServiceReady<ACheckpointManager>(this, [this](ACheckpointManager* Manager)
+        {
+            CheckpointManagerClass = Manager;
+            CheckpointManagerClass->OnCheckpointProgressChanged.AddDynamic(this, &URaceHUDWidget::HandleCheckpointProgressChanged);
+            CheckpointManagerClass->OnRemainingTimeChanged.AddDynamic(this, &URaceHUDWidget::HandleRemainingTimeChanged);
+            bLapDirty = true;
+            bRemainingTimeDirty = true;
+        });
+    }
+    if (PlayerHamsterClass)
+    {
+        PlayerHamsterClass->OnSpeedChanged.AddDynamic(this, &URaceHUDWidget::HandleSpeedChanged);
+    }
+
+    RefreshDirtyText();
 }
 
-FText URaceHUDWidget::GetSpeedText() const
+void URaceHUDWidget::NativeDestruct()
 {
+    if (CheckpointManagerClass)
+    {
+        CheckpointManagerClass->OnCheckpointProgressChanged.RemoveDynamic(this, &URaceHUDWidget::HandleCheckpointProgressChanged);
+        CheckpointManagerClass->OnRemainingTimeChanged.RemoveDynamic(this, &URaceHUDWidget::HandleRemainingTimeChanged);
+    }
     if (PlayerHamsterClass)
     {
-        return FText::FromString(FString::Printf(TEXT("Speed: %.1f km/h"), PlayerHamsterClass->GetSpeed()));
-        
+        PlayerHamsterClass->OnSpeedChanged.RemoveDynamic(this, &URaceHUDWidget::HandleSpeedChanged);
     }
-    return FText::FromString(TEXT("Speed: 0 km/h"));
+
+    Super::NativeDestruct();
+}
+
+FText URaceHUDWidget::GetSpeedText() const
+{
+    return SpeedText;
 }
 
 FText URaceHUDWidget::GetTimeText() const
 {
-    int32 Minutes = FMath::FloorToInt(ElapsedTime / 60);
-    int32 Seconds = FMath::FloorToInt(FMath::Fmod(ElapsedTime, 60));
-    return FText::FromString(FString::Printf(TEXT("Time: %02d:%02d"), Minutes, Seconds));
+    return TimeText;
 }
 
 FText URaceHUDWidget::GetLapText() const
 {
-    if (CheckpointManagerClass)
-    {
-        int32 RemainingCheckpoints = CheckpointManagerClass->GetRemainingCheckpoint();
-        int32 CurrentLap = CheckpointManagerClass->GetCurrentLap();
-        int32 TotalLaps = CheckpointManagerClass->GetTotalLaps();
-
-        return FText::FromString(FString::Printf(TEXT("Lap %d/%d \n Checkpoints Left: %d"), CurrentLap, TotalLaps, RemainingCheckpoints));
-    }
-    return FText::FromString(TEXT("Lap 0/0 | Checkpoints Left: 0"));
+    return LapText;
 }
 
 FText URaceHUDWidget::GetRemainingTimeText() const
 {
-    if (CheckpointManagerClass) // Check if CheckpointManagerClass is valid
-    { 
-		float RemainingTime = CheckpointManagerClass->GetRemainingTime(); // Get remaining time
-        int32 Minutes = FMath::FloorToInt(RemainingTime / 60);
-        int32 Seconds = FMath::FloorToInt(FMath::Fmod(RemainingTime, 60));
-		return FText::FromString(FString::Printf(TEXT("Remaining Time: %02d:%02d"), Minutes, Seconds)); // Return remaining time
-    }
-    return FText::FromString(TEXT("Remaining Time: 00:00"));
+    return RemainingTimeText;
 }
-
-
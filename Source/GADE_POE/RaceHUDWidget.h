@@ -15,6 +15,7 @@ public:
     virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
 
     /** Gets the current speed (bind this to UI) */
     UFUNCTION(BlueprintCallable, Category = "HUD")
@@ -46,4 +47,29 @@ protected:
     float ElapsedTime;
     int32 LapNumber;
     int32 TotalLapCount;
+
+    UFUNCTION()
+    void HandleSpeedChanged(float Speed);
+
+    UFUNCTION()
+    void HandleCheckpointProgressChanged();
+
+    UFUNCTION()
+    void HandleRemainingTimeChanged(int32 RemainingSeconds);
+
+private:
+    // Built when the underlying value changes, the bound getters just return these
+    FText SpeedText;
+    FText TimeText;
+    FText LapText;
+    FText RemainingTimeText;
+
+    // Set by the race events, applied at most once per frame in NativeTick
+    bool bSpeedDirty = true;
+    bool bLapDirty = true;
+    bool bRemainingTimeDirty = true;
+
+    int32 DisplayedElapsedSeconds = INDEX_NONE;
+
+    void RefreshDirtyText();
 };
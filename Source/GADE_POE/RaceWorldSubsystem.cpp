@@ -0,0 +1,60 @@
+#include "RaceWorldSubsystem.h"
+#include "GameFramework/Actor.h"
+
+void URaceWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Services.Init(nullptr, static_cast<int32>(ERaceService::Count));
+}
+
+void URaceWorldSubsystem::Deinitialize()
+{
+    Services.Reset();
+    PendingCallbacks.Reset();
+
+    Super::Deinitialize();
+}
+
+void URaceWorldSubsystem::SetService(ERaceService Service, AActor* Actor)
+{
+    if (!Actor || !Services.IsValidIndex(static_cast<int32>(Service)))
+    {
+        return;
+    }
+    Services[static_cast<int32>(Service)] = Actor;
+
+    // Pulled out first, a callback may register another service or wait on one
+    TArray<FPendingCallback> Ready;
+    for (int32 i = PendingCallbacks.Num() - 1; i >= 0; i--)
+    {
+        if (PendingCallbacks[i].Service == Service)
+        {
+            Ready.Add(MoveTemp(PendingCallbacks[i]));
+            PendingCallbacks.RemoveAt(i);
+        }
+    }
+
+    // Oldest first, the order they were requested in
+    for (int32 i = Ready.Num() - 1; i >= 0; i--)
+    {
+        if (Ready[i].Listener.IsValid())
+        {
+            Ready[i].Callback(Actor);
+        }
+    }
+}
+
+void URaceWorldSubsystem::ClearService(ERaceService Service, AActor* Actor)
+{
+    const int32 Index = static_cast<int32>(Service);
+    if (Services.IsValidIndex(Index) && Services[Index] == Actor)
+    {
+        Services[Index] = nullptr;
+    }
+}
+
+void URaceWorldSubsystem::AddPendingCallback(ERaceService Service, UObject* Listener, TFunction<void(AActor*)>&& Callback)
+{
+    PendingCallbacks.Add({ Service, Listener, MoveTemp(Callback) });
+}
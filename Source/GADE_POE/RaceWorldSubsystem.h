@@ -0,0 +1,105 @@
+/**
+ RaceWorldSubsystem
+
+ Per-world registry of the race's manager actors. Each manager registers itself
+ once it has finished setting up in BeginPlay, and anything that needs one reads
+ it back with an array lookup or asks to be called when it becomes ready. This
+ replaces searching the level with GetActorOfClass and polling on retry timers.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RaceWorldSubsystem.generated.h"
+
+class AAdvancedRaceManager;
+class AWaypointManager;
+class ACheckpointManager;
+class AGraph;
+class ASFXManager;
+class AAIRacerSimulationManager;
+
+enum class ERaceService : uint8
+{
+    RaceManager,
+    WaypointManager,
+    CheckpointManager,
+    Graph,
+    SFXManager,
+    AISimulation,
+    Count
+};
+
+/** Maps each service class to its slot */
+template<typename T> struct TRaceServiceTraits;
+template<> struct TRaceServiceTraits<AAdvancedRaceManager> { static constexpr ERaceService Service = ERaceService::RaceManager; };
+template<> struct TRaceServiceTraits<AWaypointManager> { static constexpr ERaceService Service = ERaceService::WaypointManager; };
+template<> struct TRaceServiceTraits<ACheckpointManager> { static constexpr ERaceService Service = ERaceService::CheckpointManager; };
+template<> struct TRaceServiceTraits<AGraph> { static constexpr ERaceService Service = ERaceService::Graph; };
+template<> struct TRaceServiceTraits<ASFXManager> { static constexpr ERaceService Service = ERaceService::SFXManager; };
+template<> struct TRaceServiceTraits<AAIRacerSimulationManager> { static constexpr ERaceService Service = ERaceService::AISimulation; };
+
+UCLASS()
+class GADE_POE_API URaceWorldSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Makes Service available and runs the callbacks waiting on it. Call once it is ready to be used. */
+    template<typename T>
+    void RegisterService(T* Service)
+    {
+        SetService(TRaceServiceTraits<T>::Service, Service);
+    }
+
+    /** Clears the slot if Service still holds it */
+    template<typename T>
+    void UnregisterService(T* Service)
+    {
+        ClearService(TRaceServiceTraits<T>::Service, Service);
+    }
+
+    /** The registered service, nullptr if none is ready yet */
+    template<typename T>
+    T* GetService() const
+    {
+        const int32 Index = static_cast<int32>(TRaceServiceTraits<T>::Service);
+        return Services.IsValidIndex(Index) ? static_cast<T*>(Services[Index]) : nullptr;
+    }
+
+    /**
+     * Calls Callback with the service right away if it is ready, otherwise once it registers.
+     * The call is dropped if Listener has been destroyed by then.
+     */
+    template<typename T>
+    void WhenServiceReady(UObject* Listener, TFunction<void(T*)> Callback)
+    {
+        if (T* Service = GetService<T>())
+        {
+            Callback(Service);
+            return;
+        }
+        AddPendingCallback(TRaceServiceTraits<T>::Service, Listener,
+            [Callback = MoveTemp(Callback)](AActor* Service) { Callback(static_cast<T*>(Service)); });
+    }
+
+private:
+    UPROPERTY()
+    TArray<AActor*> Services; // indexed by ERaceService
+
+    struct FPendingCallback
+    {
+        ERaceService Service;
+        TWeakObjectPtr<UObject> Listener;
+        TFunction<void(AActor*)> Callback;
+    };
+    TArray<FPendingCallback> PendingCallbacks;
+
+    void SetService(ERaceService Service, AActor* Actor);
+    void ClearService(ERaceService Service, AActor* Actor);
+    void AddPendingCallback(ERaceService Service, UObject* Listener, TFunction<void(AActor*)>&& Callback);
+};
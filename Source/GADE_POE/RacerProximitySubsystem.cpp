@@ -0,0 +1,152 @@
+#include "RacerProximitySubsystem.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+    struct FCellEntry
+    {
+        FIntPoint Cell;
+        int32 RacerIndex;
+    };
+}
+
+template<typename VisitorType>
+void URacerProximitySubsystem::ForEachWithinRadius(const FVector& Center, float Radius, const AActor* Ignore, VisitorType&& Visitor)
+{
+    RebuildIfStale();
+    if (SortedRacers.Num() == 0)
+    {
+        return;
+    }
+
+    const FIntPoint MinCell = GetCell(Center - FVector(Radius));
+    const FIntPoint MaxCell = GetCell(Center + FVector(Radius));
+    const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+
+    // A radius spanning more cells than are occupied is cheaper as a straight scan
+    const int64 NumCellsCovered = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+    if (NumCellsCovered > CellRanges.Num())
+    {
+        for (int32 i = 0; i < SortedRacers.Num(); i++)
+        {
+            if (SortedRacers[i] != Ignore && FVector::DistSquared(SortedLocations[i], Center) < RadiusSquared)
+            {
+                if (!Visitor(SortedRacers[i]))
+                {
+                    return;
+                }
+            }
+        }
+        return;
+    }
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+        {
+            const FIntPoint* Range = CellRanges.Find(FIntPoint(X, Y));
+            if (!Range)
+            {
+                continue;
+            }
+
+            for (int32 i = Range->X; i < Range->X + Range->Y; i++)
+            {
+                if (SortedRacers[i] != Ignore && FVector::DistSquared(SortedLocations[i], Center) < RadiusSquared)
+                {
+                    if (!Visitor(SortedRacers[i]))
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void URacerProximitySubsystem::RegisterRacer(AActor* Racer)
+{
+    if (Racer)
+    {
+        Racers.AddUnique(Racer);
+        BuiltFrame = MAX_uint64; // pick the new racer up on the next query, even within this frame
+    }
+}
+
+void URacerProximitySubsystem::UnregisterRacer(AActor* Racer)
+{
+    if (Racers.RemoveSwap(Racer) > 0)
+    {
+        BuiltFrame = MAX_uint64;
+    }
+}
+
+void URacerProximitySubsystem::QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutRacers, const AActor* Ignore)
+{
+    OutRacers.Reset();
+    ForEachWithinRadius(Center, Radius, Ignore, [&OutRacers](AActor* Racer)
+    {
+        OutRacers.Add(Racer);
+        return true;
+    });
+}
+
+bool URacerProximitySubsystem::AnyWithinRadius(const FVector& Center, float Radius, const AActor* Ignore)
+{
+    bool bFound = false;
+    ForEachWithinRadius(Center, Radius, Ignore, [&bFound](AActor*)
+    {
+        bFound = true;
+        return false;
+    });
+    return bFound;
+}
+
+FIntPoint URacerProximitySubsystem::GetCell(const FVector& Location) const
+{
+    // The track is mostly flat, so cells are 2D columns and height is only checked by the distance test
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void URacerProximitySubsystem::RebuildIfStale()
+{
+    if (BuiltFrame == GFrameCounter)
+    {
+        return;
+    }
+    BuiltFrame = GFrameCounter;
+
+    Racers.RemoveAllSwap([](AActor* Racer) { return !IsValid(Racer); });
+
+    // Sort racers by cell so every cell is one contiguous run in the snapshot
+    const int32 NumRacers = Racers.Num();
+    TArray<FCellEntry, TInlineAllocator<64>> Entries;
+    Entries.Reserve(NumRacers);
+    TArray<FVector, TInlineAllocator<64>> Locations;
+    Locations.Reserve(NumRacers);
+    for (int32 i = 0; i < NumRacers; i++)
+    {
+        Locations.Add(Racers[i]->GetActorLocation());
+        Entries.Add({ GetCell(Locations[i]), i });
+    }
+    Entries.Sort([](const FCellEntry& A, const FCellEntry& B)
+    {
+        return A.Cell.X != B.Cell.X ? A.Cell.X < B.Cell.X : A.Cell.Y < B.Cell.Y;
+    });
+
+    SortedLocations.Reset(NumRacers);
+    SortedRacers.Reset(NumRacers);
+    CellRanges.Reset();
+    for (int32 i = 0; i < NumRacers; i++)
+    {
+        const FCellEntry& Entry = Entries[i];
+        if (i == 0 || Entry.Cell != Entries[i - 1].Cell)
+        {
+            CellRanges.Add(Entry.Cell, FIntPoint(i, 0));
+        }
+        CellRanges[Entry.Cell].Y++;
+
+        SortedLocations.Add(Locations[Entry.RacerIndex]);
+        SortedRacers.Add(Racers[Entry.RacerIndex]);
+    }
+}
@@ -0,0 +1,51 @@
+/**
+ RacerProximitySubsystem
+
+ Shared spatial hash over all registered AI racers. The grid is rebuilt at most
+ once per frame, on the first query of that frame, so every racer's avoidance
+ check reads the same snapshot instead of iterating every actor in the world.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RacerProximitySubsystem.generated.h"
+
+UCLASS()
+class GADE_POE_API URacerProximitySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Adds a racer to the grid, picked up on the next rebuild */
+    void RegisterRacer(AActor* Racer);
+
+    void UnregisterRacer(AActor* Racer);
+
+    /** Collects every racer within Radius of Center, except Ignore */
+    void QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutRacers, const AActor* Ignore = nullptr);
+
+    /** True if any racer other than Ignore is within Radius of Center. Stops at the first hit. */
+    bool AnyWithinRadius(const FVector& Center, float Radius, const AActor* Ignore = nullptr);
+
+    /** Edge length of a grid cell, roughly the usual query radius works best */
+    float CellSize = 500.0f;
+
+private:
+    UPROPERTY()
+    TArray<AActor*> Racers;
+
+    // Snapshot for the current frame: racers sorted by cell, each cell a contiguous run
+    TArray<FVector> SortedLocations;
+    TArray<AActor*> SortedRacers;
+    TMap<FIntPoint, FIntPoint> CellRanges; // cell -> (first index, count) into the sorted arrays
+    uint64 BuiltFrame = MAX_uint64;
+
+    FIntPoint GetCell(const FVector& Location) const;
+    void RebuildIfStale();
+
+    /** Visits racers within Radius until Visitor returns false */
+    template<typename VisitorType>
+    void ForEachWithinRadius(const FVector& Center, float Radius, const AActor* Ignore, VisitorType&& Visitor);
+};
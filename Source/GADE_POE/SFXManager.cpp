@@ -1,8 +1,33 @@
 #include "SFXManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
+#include "RaceWorldSubsystem.h"
 
-// Initialize static instance pointer
-ASFXManager* ASFXManager::Instance = nullptr;
+DECLARE_STATS_GROUP(TEXT("GADE Audio"), STATGROUP_GADEAudio, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SFX Voices Started"), STAT_SFXVoicesStarted, STATGROUP_GADEAudio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SFX Voices Stolen"), STAT_SFXVoicesStolen, STATGROUP_GADEAudio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SFX Voices Culled"), STAT_SFXVoicesCulled, STATGROUP_GADEAudio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SFX Requests Coalesced"), STAT_SFXRequestsCoalesced, STATGROUP_GADEAudio);
+
+namespace
+{
+    // Keys of the built-in sounds, in ESFXSound order
+    const TCHAR* const BuiltinSoundKeys[] =
+    {
+        TEXT("waypoint"),
+        TEXT("checkpoint"),
+        TEXT("crash"),
+        TEXT("lap"),
+        TEXT("engine"),
+        TEXT("bgm"),
+        TEXT("button_click"),
+        TEXT("button_hover"),
+        TEXT("menu_open"),
+        TEXT("menu_close"),
+        TEXT("end"), // no default asset, set through DefaultSoundMappings
+    };
+    static_assert(UE_ARRAY_COUNT(BuiltinSoundKeys) == static_cast<int32>(ESFXSound::Count), "Every ESFXSound needs a key");
+}
 
 ASFXManager::ASFXManager()
 {
@@ -12,50 +37,35 @@ ASFXManager::ASFXManager()
     // Initialize all pointers to nullptr
     SoundMap = nullptr;
     BackgroundMusicComponent = nullptr;
-    PreloadedWaypointSound = nullptr;
-    PreloadedCheckpointSound = nullptr;
-    PreloadedCrashSound = nullptr;
-    PreloadedLapSound = nullptr;
-    PreloadedEngineSound = nullptr;
-    PreloadedBackgroundMusic = nullptr;
-    PreloadedButtonClickSound = nullptr;
-    PreloadedButtonHoverSound = nullptr;
-    PreloadedMenuOpenSound = nullptr;
-    PreloadedMenuCloseSound = nullptr;
 
     // Create audio component for background music
     BackgroundMusicComponent = CreateDefaultSubobject<UAudioComponent>(TEXT("BackgroundMusicComponent"));
     BackgroundMusicComponent->bAutoActivate = false;
 
-    // Preload all sound assets
-    static ConstructorHelpers::FObjectFinder<USoundBase> WaypointSound(TEXT("/Game/Assets/Sound/ding-36029"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> CheckpointSound(TEXT("/Game/Assets/Sound/collect-points-190037"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> CrashSound(TEXT("/Game/Assets/Sound/box-crash-106687"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> LapSound(TEXT("/Game/Assets/Sound/yay-6120"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> EngineSound(TEXT("/Game/Assets/Sound/engine-6000.engine-6000"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> BackgroundMusic(TEXT("/Game/Assets/Sound/under-the-streetlights-outrun-racing-1980s-synth-soundtrack-184776.under-the-streetlights-outrun-racing-1980s-synth-soundtrack-184776"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> ButtonClickSound(TEXT("/Game/Assets/Sound/ui-button-click-5-327756.ui-button-click-5-327756"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> ButtonHoverSound(TEXT("/Game/Assets/Sound/hover-button-287656.hover-button-287656"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> MenuOpenSound(TEXT("/Game/Assets/Sound/menu-button-89141.menu-button-89141"));
-    static ConstructorHelpers::FObjectFinder<USoundBase> MenuCloseSound(TEXT("/Game/Assets/Sound/menu-button-88360.menu-button-88360"));
-
-    // Assign preloaded sounds if loading was successful
-    if (WaypointSound.Succeeded()) PreloadedWaypointSound = WaypointSound.Object;
-    if (CheckpointSound.Succeeded()) PreloadedCheckpointSound = CheckpointSound.Object;
-    if (CrashSound.Succeeded()) PreloadedCrashSound = CrashSound.Object;
-    if (LapSound.Succeeded()) PreloadedLapSound = LapSound.Object;
-    if (EngineSound.Succeeded()) PreloadedEngineSound = EngineSound.Object;
-    if (BackgroundMusic.Succeeded()) PreloadedBackgroundMusic = BackgroundMusic.Object;
-    if (ButtonClickSound.Succeeded()) PreloadedButtonClickSound = ButtonClickSound.Object;
-    if (ButtonHoverSound.Succeeded()) PreloadedButtonHoverSound = ButtonHoverSound.Object;
-    if (MenuOpenSound.Succeeded()) PreloadedMenuOpenSound = MenuOpenSound.Object;
-    if (MenuCloseSound.Succeeded()) PreloadedMenuCloseSound = MenuCloseSound.Object;
+    // Only the paths are set here, each level streams in the sounds it uses
+    BuiltinSoundAssets.Add(ESFXSound::Waypoint, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/ding-36029.ding-36029"))));
+    BuiltinSoundAssets.Add(ESFXSound::Checkpoint, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/collect-points-190037.collect-points-190037"))));
+    BuiltinSoundAssets.Add(ESFXSound::Crash, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/box-crash-106687.box-crash-106687"))));
+    BuiltinSoundAssets.Add(ESFXSound::Lap, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/yay-6120.yay-6120"))));
+    BuiltinSoundAssets.Add(ESFXSound::Engine, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/engine-6000.engine-6000"))));
+    BuiltinSoundAssets.Add(ESFXSound::BackgroundMusic, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/under-the-streetlights-outrun-racing-1980s-synth-soundtrack-184776.under-the-streetlights-outrun-racing-1980s-synth-soundtrack-184776"))));
+    BuiltinSoundAssets.Add(ESFXSound::ButtonClick, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/ui-button-click-5-327756.ui-button-click-5-327756"))));
+    BuiltinSoundAssets.Add(ESFXSound::ButtonHover, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/hover-button-287656.hover-button-287656"))));
+    BuiltinSoundAssets.Add(ESFXSound::MenuOpen, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/menu-button-89141.menu-button-89141"))));
+    BuiltinSoundAssets.Add(ESFXSound::MenuClose, TSoftObjectPtr<USoundBase>(FSoftObjectPath(TEXT("/Game/Assets/Sound/menu-button-88360.menu-button-88360"))));
 }
 
 ASFXManager* ASFXManager::GetInstance(UWorld* World)
 {
-    // Create new instance if none exists
-    if (!Instance && World)
+    URaceWorldSubsystem* RaceServices = World ? World->GetSubsystem<URaceWorldSubsystem>() : nullptr;
+    if (!RaceServices)
+    {
+        return nullptr;
+    }
+
+    // One per world, so a level change never hands out the previous level's manager
+    ASFXManager* Instance = RaceServices->GetService<ASFXManager>();
+    if (!Instance)
     {
         // Set spawn parameters
         FActorSpawnParameters SpawnParams;
@@ -66,7 +76,10 @@ ASFXManager* ASFXManager::GetInstance(UWorld* World)
         if (Instance)
         {
             Instance->SetActorTickEnabled(false);
-            Instance->BeginPlay();
+
+            // Callers may spawn it while the world is still starting, before BeginPlay reaches it
+            Instance->Initialize();
+            RaceServices->RegisterService(Instance);
         }
     }
     return Instance;
@@ -76,6 +89,25 @@ void ASFXManager::BeginPlay()
 {
     Super::BeginPlay();
 
+    Initialize();
+
+    // A manager placed in the level takes the slot before anyone spawns one
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        if (!RaceServices->GetService<ASFXManager>())
+        {
+            RaceServices->RegisterService(this);
+        }
+    }
+}
+
+void ASFXManager::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+
     // Create and initialize the sound map
     SoundMap = NewObject<UHashMap>(this);
     if (!SoundMap)
@@ -83,33 +115,324 @@ void ASFXManager::BeginPlay()
         UE_LOG(LogTemp, Error, TEXT("ASFXManager: Failed to create SoundMap!"));
         return;
     }
+    bInitialized = true;
 
-    // Add all preloaded sounds to the sound map
-    if (PreloadedWaypointSound) SoundMap->Add("waypoint", PreloadedWaypointSound);
-    if (PreloadedCheckpointSound) SoundMap->Add("checkpoint", PreloadedCheckpointSound);
-    if (PreloadedCrashSound) SoundMap->Add("crash", PreloadedCrashSound);
-    if (PreloadedLapSound) SoundMap->Add("lap", PreloadedLapSound);
-    if (PreloadedEngineSound) SoundMap->Add("engine", PreloadedEngineSound);
-    if (PreloadedBackgroundMusic) SoundMap->Add("bgm", PreloadedBackgroundMusic);
-    if (PreloadedButtonClickSound) SoundMap->Add("button_click", PreloadedButtonClickSound);
-    if (PreloadedButtonHoverSound) SoundMap->Add("button_hover", PreloadedButtonHoverSound);
-    if (PreloadedMenuOpenSound) SoundMap->Add("menu_open", PreloadedMenuOpenSound);
-    if (PreloadedMenuCloseSound) SoundMap->Add("menu_close", PreloadedMenuCloseSound);
+    SlotStates.Reset();
+    VoiceStats = FSFXVoiceStats();
+
+    // Register the built-in sounds in ESFXSound order so each enum value is its slot.
+    // Nothing is loaded yet, the slots start empty and fill as their sounds stream in.
+    for (int32 i = 0; i < static_cast<int32>(ESFXSound::Count); i++)
+    {
+        const ESFXSound Sound = static_cast<ESFXSound>(i);
+        const TSoftObjectPtr<USoundBase>* Asset = BuiltinSoundAssets.Find(Sound);
+        const FSFXId SoundId = RegisterSoundPath(BuiltinSoundKeys[i], Asset ? *Asset : TSoftObjectPtr<USoundBase>());
+        check(SoundId.Index == i);
+
+        const FSFXVoiceLimits* Limits = BuiltinVoiceLimits.Find(Sound);
+        GetSlotState(SoundId.Index).Limits = Limits ? *Limits : DefaultVoiceLimits;
+    }
 
     // Add any default sound mappings from the editor
     for (const FSoundMapping& Mapping : DefaultSoundMappings)
     {
-        if (Mapping.SoundAsset) SoundMap->Add(Mapping.SoundKey, Mapping.SoundAsset);
+        if (!Mapping.SoundAsset.IsNull())
+        {
+            const FSFXId SoundId = RegisterSoundPath(Mapping.SoundKey, Mapping.SoundAsset);
+            GetSlotState(SoundId.Index).Limits = Mapping.VoiceLimits;
+        }
+    }
+
+    CreateVoicePool();
+}
+
+FSFXId ASFXManager::RegisterSoundPath(const FString& SoundKey, TSoftObjectPtr<USoundBase> Sound)
+{
+    FSFXId SoundId;
+    if (!SoundMap)
+    {
+        return SoundId;
+    }
+
+    // Already in memory (e.g. referenced by the level), no need to stream it
+    SoundId.Index = SoundMap->Add(SoundKey, Sound.Get());
+
+    FSlotState& State = GetSlotState(SoundId.Index);
+    if (State.SoundPath != Sound.ToSoftObjectPath())
+    {
+        State.SoundPath = Sound.ToSoftObjectPath();
+        State.LoadHandle.Reset();
+    }
+    return SoundId;
+}
+
+void ASFXManager::PreloadSounds(const FSFXPreloadSet& PreloadSet)
+{
+    for (ESFXSound Sound : PreloadSet.BuiltinSounds)
+    {
+        RequestLoad(FSFXId(Sound).Index);
+    }
+
+    for (const FString& SoundKey : PreloadSet.SoundKeys)
+    {
+        const FSFXId SoundId = FindSoundId(SoundKey);
+        if (SoundId.IsValid())
+        {
+            RequestLoad(SoundId.Index);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ASFXManager: Can't preload unregistered sound %s"), *SoundKey);
+        }
+    }
+}
+
+bool ASFXManager::IsSoundLoaded(FSFXId SoundId) const
+{
+    return SoundMap && SoundMap->GetAt(SoundId.Index) != nullptr;
+}
+
+void ASFXManager::RequestLoad(int32 Slot)
+{
+    if (!SlotStates.IsValidIndex(Slot))
+    {
+        return;
+    }
+
+    const FSlotState& State = SlotStates[Slot];
+    if (State.LoadHandle.IsValid() || State.SoundPath.IsNull() || SoundMap->GetAt(Slot))
+    {
+        return; // already streaming, nothing to stream, or already loaded
+    }
+
+    TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(State.SoundPath,
+        FStreamableDelegate::CreateWeakLambda(this, [this, Slot]()
+        {
+            OnSoundLoaded(Slot);
+        }));
+
+    // Looked up again, the callback may already have run if the sound was in memory
+    SlotStates[Slot].LoadHandle = Handle;
+}
+
+void ASFXManager::OnSoundLoaded(int32 Slot)
+{
+    if (!SoundMap || !SlotStates.IsValidIndex(Slot))
+    {
+        return;
+    }
+
+    FSlotState& State = SlotStates[Slot];
+    USoundBase* Sound = Cast<USoundBase>(State.SoundPath.ResolveObject());
+    if (!Sound)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ASFXManager: Could not load sound %s"), *State.SoundPath.ToString());
+        State.bPlayWhenLoaded = false;
+        return;
+    }
+
+    SoundMap->SetAt(Slot, Sound);
+
+    // Play whatever was asked for while the sound was still streaming
+    if (State.bPlayWhenLoaded)
+    {
+        State.bPlayWhenLoaded = false;
+        FSFXId SoundId;
+        SoundId.Index = Slot;
+        PlaySoundById(SoundId);
+    }
+
+    if (Slot == PendingMusicSlot)
+    {
+        PendingMusicSlot = INDEX_NONE;
+        if (BackgroundMusicComponent)
+        {
+            BackgroundMusicComponent->SetSound(Sound);
+            BackgroundMusicComponent->Play();
+        }
+    }
+}
+
+void ASFXManager::CreateVoicePool()
+{
+    for (UAudioComponent* Voice : Voices)
+    {
+        if (Voice)
+        {
+            Voice->DestroyComponent();
+        }
+    }
+    Voices.Reset(MaxVoices);
+
+    // One-shot sounds reuse these instead of spawning a new audio object per call
+    for (int32 i = 0; i < MaxVoices; i++)
+    {
+        UAudioComponent* Voice = NewObject<UAudioComponent>(this);
+        Voice->bAutoActivate = false;
+        Voice->bAutoDestroy = false;
+        Voice->bAllowSpatialization = false; // 2D, same as PlaySound2D
+        Voice->RegisterComponent();
+        Voices.Add(Voice);
+    }
+
+    VoiceStates.Reset(MaxVoices);
+    VoiceStates.SetNum(MaxVoices);
+}
+
+ASFXManager::FSlotState& ASFXManager::GetSlotState(int32 Slot)
+{
+    // Sounds added at runtime get their state on first use
+    while (SlotStates.Num() <= Slot)
+    {
+        SlotStates.AddDefaulted_GetRef().Limits = DefaultVoiceLimits;
+    }
+    return SlotStates[Slot];
+}
+
+void ASFXManager::SetVoiceLimits(FSFXId SoundId, const FSFXVoiceLimits& Limits)
+{
+    if (SoundId.IsValid())
+    {
+        GetSlotState(SoundId.Index).Limits = Limits;
     }
 }
 
 // Generic sound functions
 void ASFXManager::PlaySound(const FString& SoundKey)
 {
-    if (USoundBase* Sound = Cast<USoundBase>(SoundMap->Get(SoundKey)))
+    PlaySoundById(FindSoundId(SoundKey));
+}
+
+FSFXId ASFXManager::FindSoundId(const FString& SoundKey) const
+{
+    FSFXId SoundId;
+    if (SoundMap)
     {
-        UGameplayStatics::PlaySound2D(this, Sound);
+        SoundId.Index = SoundMap->FindIndex(SoundKey);
     }
+    return SoundId;
+}
+
+void ASFXManager::PlaySoundById(FSFXId SoundId)
+{
+    USoundBase* Sound = SoundMap ? SoundMap->GetAt(SoundId.Index) : nullptr;
+    if (!Sound)
+    {
+        // Not streamed in yet, play it once it arrives
+        if (SlotStates.IsValidIndex(SoundId.Index) && !SlotStates[SoundId.Index].SoundPath.IsNull())
+        {
+            SlotStates[SoundId.Index].bPlayWhenLoaded = true;
+            RequestLoad(SoundId.Index);
+        }
+        return;
+    }
+
+    FSlotState& Slot = GetSlotState(SoundId.Index);
+
+    // Several racers hitting a waypoint in the same frame would only stack identical voices
+    if (Slot.LastStartFrame == GFrameCounter)
+    {
+        VoiceStats.RequestsCoalesced++;
+        INC_DWORD_STAT(STAT_SFXRequestsCoalesced);
+        return;
+    }
+
+    // Real time, so menu sounds aren't held back while the game is paused
+    const double Now = FPlatformTime::Seconds();
+    if (Now - Slot.LastStartTime < Slot.Limits.MinRetriggerInterval)
+    {
+        VoiceStats.VoicesCulled++;
+        INC_DWORD_STAT(STAT_SFXVoicesCulled);
+        return;
+    }
+
+    const int32 VoiceIndex = FindVoiceFor(SoundId.Index, Slot.Limits);
+    if (VoiceIndex == INDEX_NONE)
+    {
+        VoiceStats.VoicesCulled++;
+        INC_DWORD_STAT(STAT_SFXVoicesCulled);
+        return;
+    }
+
+    UAudioComponent* Voice = Voices[VoiceIndex];
+    Voice->SetSound(Sound);
+    Voice->Play(); // restarts the voice if it was stolen
+
+    FVoiceState& State = VoiceStates[VoiceIndex];
+    State.Slot = SoundId.Index;
+    State.Priority = Slot.Limits.Priority;
+    State.StartTime = Now;
+
+    Slot.LastStartTime = Now;
+    Slot.LastStartFrame = GFrameCounter;
+    VoiceStats.VoicesStarted++;
+    INC_DWORD_STAT(STAT_SFXVoicesStarted);
+}
+
+int32 ASFXManager::FindVoiceFor(int32 Slot, const FSFXVoiceLimits& Limits)
+{
+    int32 FreeVoice = INDEX_NONE;
+    int32 SameSoundVoices = 0;
+    int32 OldestSameSound = INDEX_NONE;
+    int32 StealCandidate = INDEX_NONE; // lowest priority not above ours, oldest first
+
+    for (int32 i = 0; i < Voices.Num(); i++)
+    {
+        FVoiceState& State = VoiceStates[i];
+        if (State.Slot != INDEX_NONE && !Voices[i]->IsPlaying())
+        {
+            State.Slot = INDEX_NONE; // finished since the last request
+        }
+
+        if (State.Slot == INDEX_NONE)
+        {
+            if (FreeVoice == INDEX_NONE)
+            {
+                FreeVoice = i;
+            }
+            continue;
+        }
+
+        if (State.Slot == Slot)
+        {
+            SameSoundVoices++;
+            if (OldestSameSound == INDEX_NONE || State.StartTime < VoiceStates[OldestSameSound].StartTime)
+            {
+                OldestSameSound = i;
+            }
+        }
+
+        if (State.Priority <= Limits.Priority)
+        {
+            const FVoiceState* Candidate = StealCandidate != INDEX_NONE ? &VoiceStates[StealCandidate] : nullptr;
+            if (!Candidate || State.Priority < Candidate->Priority
+                || (State.Priority == Candidate->Priority && State.StartTime < Candidate->StartTime))
+            {
+                StealCandidate = i;
+            }
+        }
+    }
+
+    // At the per-sound cap the oldest copy restarts rather than adding another voice
+    if (SameSoundVoices >= Limits.MaxConcurrent && OldestSameSound != INDEX_NONE)
+    {
+        VoiceStats.VoicesStolen++;
+        INC_DWORD_STAT(STAT_SFXVoicesStolen);
+        return OldestSameSound;
+    }
+
+    if (FreeVoice != INDEX_NONE)
+    {
+        return FreeVoice;
+    }
+
+    if (StealCandidate != INDEX_NONE)
+    {
+        VoiceStats.VoicesStolen++;
+        INC_DWORD_STAT(STAT_SFXVoicesStolen);
+        return StealCandidate;
+    }
+    return INDEX_NONE;
 }
 
 void ASFXManager::AddSound(const FString& SoundKey, USoundBase* Sound)
@@ -123,7 +446,19 @@ void ASFXManager::AddSound(const FString& SoundKey, USoundBase* Sound)
 // Background music functions
 void ASFXManager::PlayBackgroundMusic(const FString& SoundKey)
 {
-    if (USoundBase* Sound = Cast<USoundBase>(SoundMap->Get(SoundKey)))
+    const FSFXId SoundId = FindSoundId(SoundKey);
+    PendingMusicSlot = INDEX_NONE;
+
+    USoundBase* Sound = SoundMap ? SoundMap->GetAt(SoundId.Index) : nullptr;
+    if (!Sound && SlotStates.IsValidIndex(SoundId.Index))
+    {
+        // Starts from OnSoundLoaded once the track has streamed in
+        PendingMusicSlot = SoundId.Index;
+        RequestLoad(SoundId.Index);
+        return;
+    }
+
+    if (Sound)
     {
         if (BackgroundMusicComponent)
         {
@@ -135,6 +470,8 @@ void ASFXManager::PlayBackgroundMusic(const FString& SoundKey)
 
 void ASFXManager::StopBackgroundMusic()
 {
+    PendingMusicSlot = INDEX_NONE;
+
     if (BackgroundMusicComponent && BackgroundMusicComponent->IsPlaying())
     {
         BackgroundMusicComponent->Stop();
@@ -144,22 +481,22 @@ void ASFXManager::StopBackgroundMusic()
 // UI Sound Functions
 void ASFXManager::PlayButtonClickSound()
 {
-    PlaySound("button_click");
+    PlaySoundById(ESFXSound::ButtonClick);
 }
 
 void ASFXManager::PlayButtonHoverSound()
 {
-    PlaySound("button_hover");
+    PlaySoundById(ESFXSound::ButtonHover);
 }
 
 void ASFXManager::PlayMenuOpenSound()
 {
-    PlaySound("menu_open");
+    PlaySoundById(ESFXSound::MenuOpen);
 }
 
 void ASFXManager::PlayMenuCloseSound()
 {
-    PlaySound("menu_close");
+    PlaySoundById(ESFXSound::MenuClose);
 }
 
 void ASFXManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -172,9 +509,16 @@ void ASFXManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
         BackgroundMusicComponent->Stop();
     }
 
-    // Clear the singleton instance
-    if (Instance == this)
+    for (UAudioComponent* Voice : Voices)
+    {
+        if (Voice)
+        {
+            Voice->Stop();
+        }
+    }
+
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
     {
-        Instance = nullptr;
+        RaceServices->UnregisterService(this);
     }
 }
\ No newline at end of file
@@ -10,8 +10,84 @@
 #include "HashMap.h"
 #include "Sound/SoundBase.h"
 #include "Components/AudioComponent.h"
+#include "Engine/StreamableManager.h"
 #include "SFXManager.generated.h"
 
+// Built-in sounds, each value is the sound's slot in the sound map
+UENUM(BlueprintType)
+enum class ESFXSound : uint8
+{
+    Waypoint,
+    Checkpoint,
+    Crash,
+    Lap,
+    Engine,
+    BackgroundMusic,
+    ButtonClick,
+    ButtonHover,
+    MenuOpen,
+    MenuClose,
+    End,
+    Count UMETA(Hidden)
+};
+
+// Interned handle to a registered sound, resolve it once and play it without any string work
+USTRUCT(BlueprintType)
+struct FSFXId
+{
+    GENERATED_BODY()
+
+    // Slot in the sound map, INDEX_NONE if the key wasn't registered
+    UPROPERTY(BlueprintReadOnly, Category = "SFX")
+    int32 Index = INDEX_NONE;
+
+    FSFXId() {}
+    FSFXId(ESFXSound Sound) : Index(static_cast<int32>(Sound)) {}
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+// Voice limits for one sound key
+USTRUCT(BlueprintType)
+struct FSFXVoiceLimits
+{
+    GENERATED_BODY()
+
+    // Voices of this sound that may play at once, past this the oldest one restarts
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX", meta = (ClampMin = "1"))
+    int32 MaxConcurrent = 3;
+
+    // Seconds before the same sound may start again, requests inside the window are culled
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX", meta = (ClampMin = "0"))
+    float MinRetriggerInterval = 0.05f;
+
+    // When every voice is busy, a sound may take over a voice of equal or lower priority
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX")
+    int32 Priority = 0;
+};
+
+// Playback counters since the manager began play
+USTRUCT(BlueprintType)
+struct FSFXVoiceStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "SFX")
+    int32 VoicesStarted = 0;
+
+    // Voices cut short to make room for another request
+    UPROPERTY(BlueprintReadOnly, Category = "SFX")
+    int32 VoicesStolen = 0;
+
+    // Requests dropped by the retrigger interval or because no voice could be freed
+    UPROPERTY(BlueprintReadOnly, Category = "SFX")
+    int32 VoicesCulled = 0;
+
+    // Repeats of a sound that already started this frame
+    UPROPERTY(BlueprintReadOnly, Category = "SFX")
+    int32 RequestsCoalesced = 0;
+};
+
 // Structure to map sound keys to sound assets 
 USTRUCT(BlueprintType)
 struct FSoundMapping
@@ -22,9 +98,26 @@ struct FSoundMapping
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX")
     FString SoundKey;
 
-    // The actual sound asset
+    // The actual sound asset, streamed in when first played or preloaded
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX")
-    USoundBase* SoundAsset;
+    TSoftObjectPtr<USoundBase> SoundAsset;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX")
+    FSFXVoiceLimits VoiceLimits;
+};
+
+// Sounds a game mode wants loaded before they are first played
+USTRUCT(BlueprintType)
+struct FSFXPreloadSet
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX")
+    TArray<ESFXSound> BuiltinSounds;
+
+    // Keys registered through DefaultSoundMappings or RegisterSoundPath
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SFX")
+    TArray<FString> SoundKeys;
 };
 
 UCLASS()
@@ -33,9 +126,6 @@ class GADE_POE_API ASFXManager : public AActor
     GENERATED_BODY()
 
 private:
-	// Singleton instance of the SFX manager
-	static ASFXManager* Instance;
-
     // HashMap to store sound mappings
     UPROPERTY()
 	UHashMap* SoundMap;
@@ -44,44 +134,47 @@ private:
     UPROPERTY()
 	UAudioComponent* BackgroundMusicComponent;
 
-    // Preloaded sound assets
-    UPROPERTY()
-	USoundBase* PreloadedWaypointSound;
-
-    UPROPERTY()
-	USoundBase* PreloadedCheckpointSound;
-
-    UPROPERTY()
-	USoundBase* PreloadedCrashSound;
-
-    UPROPERTY()
-	USoundBase* PreloadedLapSound;
-
-    UPROPERTY()
-	USoundBase* PreloadedEngineSound;
-
-	UPROPERTY()
-	USoundBase* PreloadedBackgroundMusic;
-
-    // UI Sound Effects
-    UPROPERTY()
-    USoundBase* PreloadedButtonClickSound;
-
-    UPROPERTY()
-    USoundBase* PreloadedButtonHoverSound;
-
-    UPROPERTY()
-    USoundBase* PreloadedMenuOpenSound;
-
+    // Pooled voices that every one-shot sound plays through
     UPROPERTY()
-    USoundBase* PreloadedMenuCloseSound;
+    TArray<UAudioComponent*> Voices;
+
+    struct FVoiceState
+    {
+        int32 Slot = INDEX_NONE; // sound slot playing on the voice, INDEX_NONE when free
+        int32 Priority = 0;
+        double StartTime = 0.0;
+    };
+    TArray<FVoiceState> VoiceStates; // parallel to Voices
+
+    struct FSlotState
+    {
+        FSFXVoiceLimits Limits;
+        double LastStartTime = TNumericLimits<double>::Lowest();
+        uint64 LastStartFrame = MAX_uint64;
+        FSoftObjectPath SoundPath; // where to stream the sound from, empty for sounds added loaded
+        TSharedPtr<FStreamableHandle> LoadHandle; // keeps the streamed sound resident
+        bool bPlayWhenLoaded = false; // requested before it finished streaming
+    };
+    TArray<FSlotState> SlotStates; // indexed by sound slot
+
+    FSFXVoiceStats VoiceStats;
+
+    int32 PendingMusicSlot = INDEX_NONE; // background music waiting on its stream
+    bool bInitialized = false;
+
+    void Initialize(); // builds the sound map and voice pool once, from GetInstance or BeginPlay
+    void CreateVoicePool();
+    FSlotState& GetSlotState(int32 Slot);
+    void RequestLoad(int32 Slot);
+    void OnSoundLoaded(int32 Slot);
+    int32 FindVoiceFor(int32 Slot, const FSFXVoiceLimits& Limits); // INDEX_NONE culls the request
 
 protected:
-	// Constructor - initialize components and preload sounds
+	// Constructor - initialize components, sounds are only streamed in when needed
 	ASFXManager();
 
 public:
-	// Static function to get the singleton instance
+	// The world's SFX manager from the race services, spawned on first use
 	static ASFXManager* GetInstance(UWorld* World);
 
 	// Called when the game starts
@@ -97,6 +190,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SFX")
 	void AddSound(const FString& SoundKey, USoundBase* Sound);
 
+	// Registers a sound by path without loading it, it streams in when first played or preloaded
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	FSFXId RegisterSoundPath(const FString& SoundKey, TSoftObjectPtr<USoundBase> Sound);
+
+	// Starts streaming every sound in the set, call it when a level starts
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	void PreloadSounds(const FSFXPreloadSet& PreloadSet);
+
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	bool IsSoundLoaded(FSFXId SoundId) const;
+
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	void SetVoiceLimits(FSFXId SoundId, const FSFXVoiceLimits& Limits);
+
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	FSFXVoiceStats GetVoiceStats() const { return VoiceStats; }
+
+	// Resolves a key to its interned ID, do this once and keep the ID
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	FSFXId FindSoundId(const FString& SoundKey) const;
+
+	// Plays a sound by ID, a single array lookup. Built-in sounds convert from ESFXSound.
+	UFUNCTION(BlueprintCallable, Category = "SFX")
+	void PlaySoundById(FSFXId SoundId);
+
 	// Background music functions
 	UFUNCTION(BlueprintCallable, Category = "SFX")
 	void PlayBackgroundMusic(const FString& SoundKey);
@@ -117,6 +235,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SFX|UI")
 	void PlayMenuCloseSound();
 
+	// Size of the one-shot voice pool
+	UPROPERTY(EditAnywhere, Category = "SFX|Voices", meta = (ClampMin = "1"))
+	int32 MaxVoices = 16;
+
+	// Limits for built-in and runtime-added sounds without their own
+	UPROPERTY(EditAnywhere, Category = "SFX|Voices")
+	FSFXVoiceLimits DefaultVoiceLimits;
+
+	UPROPERTY(EditAnywhere, Category = "SFX|Voices")
+	TMap<ESFXSound, FSFXVoiceLimits> BuiltinVoiceLimits;
+
+	// Where each built-in sound streams from
+	UPROPERTY(EditAnywhere, Category = "SFX")
+	TMap<ESFXSound, TSoftObjectPtr<USoundBase>> BuiltinSoundAssets;
+
 	// Default sound mappings that can be set in the editor
 	UPROPERTY(EditAnywhere, Category = "SFX")
 	TArray<FSoundMapping> DefaultSoundMappings;
@@ -1,129 +1,225 @@
 #pragma once
 #include "CoreMinimal.h"
-#include "TempLinkedList.h"
+#include "GADE_POE.h"
 
+/**
+ * Flat open-addressing hash map (Robin Hood probing) for pointer keys.
+ * Keys and values live inline in a single slot array that doubles in size once
+ * the load factor passes MaxLoadFactor. Pointers returned by Get are invalidated
+ * by any Add that triggers a grow, so don't hold them across inserts.
+ */
 template<typename K, typename V>
 class TempHashMap
 {
 private:
-    struct HashNode
+    struct FSlot
     {
-		K Key; // key of the node, should be a pointer type
-        V Value; // value of the key if found
-        HashNode(const K& InKey, const V& InValue) : Key(InKey), Value(InValue) {}
-        bool operator==(const HashNode& Other) const { return Key == Other.Key; }
+        K Key; // key of the slot, should be a pointer type
+        V Value; // value stored inline with the key
+        int32 Distance; // probe distance + 1, 0 means the slot is empty
+
+        FSlot() : Key(), Value(), Distance(0) {}
     };
 
-    static const int32 BucketCount = 64;
-    TempLinkedList<HashNode> Buckets[BucketCount]; // array of linked lists
+    static constexpr int32 InitialCapacity = 64; // must be a power of two
+    static constexpr float MaxLoadFactor = 0.75f;
+
+    TArray<FSlot> Slots; // capacity is always zero or a power of two
+    int32 Count;
 
-    int32 GetBucketIndex(const K& Key) const // hash function
+    static uint32 HashKey(const K& Key) // hash function
     {
-        if (!Key || !Key->IsValidLowLevel()) // check if key is valid
+        // Mix the pointer hash so aligned addresses spread over the low bits we mask with
+        uint32 Hash = GetTypeHash(Key);
+        Hash ^= Hash >> 16;
+        Hash *= 0x85ebca6bu;
+        Hash ^= Hash >> 13;
+        Hash *= 0xc2b2ae35u;
+        Hash ^= Hash >> 16;
+        return Hash;
+    }
+
+    int32 FindSlot(const K& Key) const // index of the slot holding Key, or INDEX_NONE
+    {
+        if (Slots.Num() == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const int32 Mask = Slots.Num() - 1;
+        int32 Index = HashKey(Key) & Mask;
+        for (int32 Distance = 1; ; ++Distance)
+        {
+            const FSlot& Slot = Slots[Index];
+            if (Slot.Distance < Distance) // empty, or a richer key would have displaced ours
+            {
+                return INDEX_NONE;
+            }
+            if (Slot.Key == Key)
+            {
+                return Index;
+            }
+            Index = (Index + 1) & Mask;
+        }
+    }
+
+    void InsertNew(K Key, V&& Value) // caller guarantees Key is absent and there is room
+    {
+        const int32 Mask = Slots.Num() - 1;
+        int32 Index = HashKey(Key) & Mask;
+
+        FSlot Incoming;
+        Incoming.Key = Key;
+        Incoming.Value = MoveTemp(Value);
+        Incoming.Distance = 1;
+
+        while (true)
+        {
+            FSlot& Slot = Slots[Index];
+            if (Slot.Distance == 0)
+            {
+                Slot = MoveTemp(Incoming);
+                Count++;
+                return;
+            }
+            if (Slot.Distance < Incoming.Distance) // steal from the rich
+            {
+                Swap(Slot, Incoming);
+            }
+            Index = (Index + 1) & Mask;
+            Incoming.Distance++;
+        }
+    }
+
+    void Rehash(int32 NewCapacity)
+    {
+        TArray<FSlot> OldSlots = MoveTemp(Slots);
+        Slots.Empty(NewCapacity);
+        Slots.SetNum(NewCapacity);
+        Count = 0;
+
+        for (FSlot& Slot : OldSlots)
+        {
+            if (Slot.Distance > 0)
+            {
+                InsertNew(Slot.Key, MoveTemp(Slot.Value));
+            }
+        }
+    }
+
+    void GrowIfNeeded()
+    {
+        if (Slots.Num() == 0)
+        {
+            Rehash(InitialCapacity);
+        }
+        else if (Count + 1 > static_cast<int32>(Slots.Num() * MaxLoadFactor))
         {
-            UE_LOG(LogTemp, Warning, TEXT("TempHashMap::GetBucketIndex - Invalid or null key"));
-            return 0;
+            Rehash(Slots.Num() * 2);
         }
-        return GetTypeHash(Key) & (BucketCount - 1);
     }
 
 public:
-    TempHashMap() {}
+    TempHashMap() : Count(0) {}
 
     void Add(const K& Key, const V& Value)
+    {
+        V Copy = Value;
+        Add(Key, MoveTemp(Copy));
+    }
+
+    void Add(const K& Key, V&& Value)
     {
         if (!Key || !Key->IsValidLowLevel()) // check if key is valid
         {
-            UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Add - Invalid or null key"));
+            GADE_LOG_RATE_LIMITED(LogGADERaceNav, Warning, 1.0, TEXT("TempHashMap::Add - Invalid or null key"));
             return;
         }
-        int32 Index = GetBucketIndex(Key);
-        TNode<HashNode>* Node = Buckets[Index].Find([Key](const HashNode& N) {
-            if (!N.Key)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Add - Null key in HashNode"));
-                return false;
-            }
-            return N.Key && N.Key->IsValidLowLevel() && Key && Key->IsValidLowLevel() && N.Key == Key;
-            });
-        if (Node)
-        {
-            Node->Data.Value = Value;
-        }
-        else
+
+        const int32 Existing = FindSlot(Key);
+        if (Existing != INDEX_NONE)
         {
-            Buckets[Index].Add(HashNode(Key, Value));
+            Slots[Existing].Value = MoveTemp(Value);
+            return;
         }
+
+        GrowIfNeeded();
+        InsertNew(Key, MoveTemp(Value));
     }
 
     V* Get(const K& Key) const // get value by key from hash table
     {
-        if (!Key || !Key->IsValidLowLevel())
+        if (!Key)
         {
-            UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Get - Invalid or null key"));
             return nullptr;
         }
-        int32 Index = GetBucketIndex(Key);
-        TNode<HashNode>* Node = Buckets[Index].Find([Key](const HashNode& N) {
-            if (!N.Key)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Get - Null key in HashNode"));
-                return false;
-            }
-            if (!N.Key->IsValidLowLevel())
-            {
-                UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Get - Invalid node key in bucket"));
-                return false;
-            }
-            return N.Key == Key;
-            });
-        return Node ? &Node->Data.Value : nullptr;
+        const int32 Index = FindSlot(Key);
+        return Index != INDEX_NONE ? const_cast<V*>(&Slots[Index].Value) : nullptr;
     }
 
-	void Remove(const K& Key) // remove key from hash table 
+    void Remove(const K& Key) // remove key from hash table
     {
-        if (!Key || !Key->IsValidLowLevel())
+        if (!Key)
         {
-            UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Remove - Invalid or null key"));
+            GADE_LOG_RATE_LIMITED(LogGADERaceNav, Warning, 1.0, TEXT("TempHashMap::Remove - Null key"));
             return;
         }
-        int32 Index = GetBucketIndex(Key);
-        int32 OldCount = Buckets[Index].GetCount();
-        Buckets[Index].Remove([Key](const HashNode& N) {
-            if (!N.Key)
+
+        int32 Index = FindSlot(Key);
+        if (Index == INDEX_NONE)
+        {
+            return;
+        }
+
+        // Backward-shift deletion keeps probe sequences intact without tombstones
+        const int32 Mask = Slots.Num() - 1;
+        int32 Next = (Index + 1) & Mask;
+        while (Slots[Next].Distance > 1)
+        {
+            Slots[Index] = MoveTemp(Slots[Next]);
+            Slots[Index].Distance--;
+            Index = Next;
+            Next = (Next + 1) & Mask;
+        }
+        Slots[Index] = FSlot();
+        Count--;
+    }
+
+    void Clear() // clear all slots, keeps the allocation for reuse
+    {
+        for (FSlot& Slot : Slots)
+        {
+            if (Slot.Distance > 0)
             {
-                UE_LOG(LogTemp, Warning, TEXT("TempHashMap::Remove - Null key in HashNode"));
-                return false;
+                Slot = FSlot();
             }
-            return N.Key && N.Key->IsValidLowLevel() && Key && Key->IsValidLowLevel() && N.Key == Key;
-            });
-        if (Buckets[Index].GetCount() < OldCount)
-        {
-            UE_LOG(LogTemp, Log, TEXT("TempHashMap::Remove - Removed key from bucket %d"), Index);
         }
+        Count = 0;
     }
 
-	void Clear() // clear all buckets in hash table
+    void Reserve(int32 NumKeys) // grow up front so NumKeys inserts never rehash
     {
-        for (int32 i = 0; i < BucketCount; i++)
+        int32 NewCapacity = FMath::Max(Slots.Num(), InitialCapacity);
+        while (NumKeys > static_cast<int32>(NewCapacity * MaxLoadFactor))
+        {
+            NewCapacity *= 2;
+        }
+        if (NewCapacity != Slots.Num())
         {
-            Buckets[i].Clear();
+            Rehash(NewCapacity);
         }
     }
 
+    int32 Num() const { return Count; }
+
     void GetAllKeys(TArray<K>& OutKeys) const // get all keys from hash table
     {
-        OutKeys.Empty();
-        for (int32 i = 0; i < BucketCount; i++)
+        OutKeys.Reset(Count);
+        for (const FSlot& Slot : Slots)
         {
-            TNode<HashNode>* Current = Buckets[i].GetHead();
-            while (Current)
+            if (Slot.Distance > 0 && Slot.Key->IsValidLowLevel())
             {
-                if (Current->Data.Key && Current->Data.Key->IsValidLowLevel())
-                {
-                    OutKeys.Add(Current->Data.Key);
-                }
-                Current = Current->Next;
+                OutKeys.Add(Slot.Key);
             }
         }
     }
@@ -1,5 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
+#include "GADE_POE.h"
+#include "NodePool.h"
 #include <functional>
 
 #define TEMPLINKEDLIST_DEBUG 1
@@ -17,31 +19,122 @@ struct TNode
 template<typename T>
 class TempLinkedList
 {
+public:
+    using FNodePool = TNodePool<TNode<T>>;
+
 private:
     TNode<T>* Head;
+    TNode<T>* Tail; // last node, so Add doesn't walk the list
     int32 Count;
+    bool bIndexed; // keep NodeIndex so GetAt is O(1)
+    mutable bool bIndexDirty; // NodeIndex needs a rebuild after a Remove
+    mutable TArray<TNode<T>*> NodeIndex; // node at each position, only maintained when bIndexed
+    FNodePool LocalPool; // used unless the list was given a shared pool
+    FNodePool* SharedPool; // null for LocalPool. Never points into the list itself, so slots holding lists can be moved bitwise.
 
 public:
-    TempLinkedList() : Head(nullptr), Count(0) {}
+    TempLinkedList() : Head(nullptr), Tail(nullptr), Count(0), bIndexed(false), bIndexDirty(false), SharedPool(nullptr) {}
+
+    /** Allocates nodes from SharedPool, which must outlive the list */
+    explicit TempLinkedList(FNodePool* InSharedPool)
+        : Head(nullptr), Tail(nullptr), Count(0), bIndexed(false), bIndexDirty(false), SharedPool(InSharedPool) {}
+
     ~TempLinkedList() { Clear(); }
 
+    // Deep copy so lists stored by value (e.g. inside hash map slots) never share nodes.
+    // The copy shares the source's pool if it has a shared one.
+    TempLinkedList(const TempLinkedList& Other)
+        : Head(nullptr), Tail(nullptr), Count(0), bIndexed(Other.bIndexed), bIndexDirty(Other.bIndexed), SharedPool(Other.SharedPool)
+    {
+        CopyFrom(Other);
+    }
+
+    // Nodes stay in the pool they came from, so a local pool moves with them
+    TempLinkedList(TempLinkedList&& Other)
+        : Head(Other.Head), Tail(Other.Tail), Count(Other.Count), bIndexed(Other.bIndexed), bIndexDirty(Other.bIndexDirty),
+        NodeIndex(MoveTemp(Other.NodeIndex)), LocalPool(MoveTemp(Other.LocalPool)), SharedPool(Other.SharedPool)
+    {
+        Other.Head = nullptr;
+        Other.Tail = nullptr;
+        Other.Count = 0;
+        Other.NodeIndex.Reset();
+        Other.bIndexDirty = false;
+    }
+
+    TempLinkedList& operator=(const TempLinkedList& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            bIndexed = Other.bIndexed;
+            bIndexDirty = Other.bIndexed;
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TempLinkedList& operator=(TempLinkedList&& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            SharedPool = Other.SharedPool;
+            if (!SharedPool)
+            {
+                LocalPool = MoveTemp(Other.LocalPool);
+            }
+            Head = Other.Head;
+            Tail = Other.Tail;
+            Count = Other.Count;
+            bIndexed = Other.bIndexed;
+            bIndexDirty = Other.bIndexDirty;
+            NodeIndex = MoveTemp(Other.NodeIndex);
+            Other.Head = nullptr;
+            Other.Tail = nullptr;
+            Other.Count = 0;
+            Other.NodeIndex.Reset();
+            Other.bIndexDirty = false;
+        }
+        return *this;
+    }
+
+    /**
+     * Indexed mode keeps a dense array of node pointers next to the links, so GetAt is O(1)
+     * at the cost of one pointer per element. Nodes come from the pool's slabs in append
+     * order, so walking the index stays mostly sequential in memory.
+     */
+    void SetIndexed(bool bInIndexed)
+    {
+        bIndexed = bInIndexed;
+        NodeIndex.Reset();
+        bIndexDirty = bIndexed;
+    }
+
+    bool IsIndexed() const { return bIndexed; }
+
+    /** Pre-allocates room for NumNodes more elements */
+    void Reserve(int32 NumNodes) { GetPool().Reserve(NumNodes); }
+
+    const FNodePoolStats& GetPoolStats() const { return GetPool().GetStats(); }
+
     void Add(const T& Data)
     {
-        TNode<T>* NewNode = new TNode<T>(Data);
+        TNode<T>* NewNode = GetPool().Acquire(Data);
         if (!Head)
         {
             Head = NewNode;
         }
         else
         {
-            TNode<T>* Current = Head;
-            while (Current->Next)
-            {
-                Current = Current->Next;
-            }
-            Current->Next = NewNode;
+            Tail->Next = NewNode;
         }
+        Tail = NewNode;
         Count++;
+
+        if (bIndexed && !bIndexDirty)
+        {
+            NodeIndex.Add(NewNode);
+        }
     }
 
     void Remove(std::function<bool(const T&)> Predicate)
@@ -62,9 +155,14 @@ public:
                 {
                     Head = Current->Next;
                 }
+                if (Current == Tail)
+                {
+                    Tail = Prev;
+                }
                 Current = Current->Next;
-                delete NodeToDelete;
+                GetPool().Release(NodeToDelete);
                 Count--;
+                bIndexDirty = bIndexed;
             }
             else
             {
@@ -78,9 +176,17 @@ public:
     {
         if (Index < 0 || Index >= Count)
         {
-            UE_LOG(LogTemp, Warning, TEXT("TempLinkedList::GetAt - Index out of range: %d"), Index);
+            GADE_LOG_RATE_LIMITED(LogGADERaceNav, Warning, 1.0, TEXT("TempLinkedList::GetAt - Index out of range: %d"), Index);
             return T();
         }
+        if (bIndexed)
+        {
+            if (bIndexDirty)
+            {
+                RebuildIndex();
+            }
+            return NodeIndex[Index]->Data;
+        }
         TNode<T>* Current = Head;
         for (int32 i = 0; i < Index; i++)
         {
@@ -97,18 +203,21 @@ public:
         while (Current)
         {
             TNode<T>* Next = Current->Next;
-            delete Current;
+            GetPool().Release(Current);
             Current = Next;
         }
         Head = nullptr;
+        Tail = nullptr;
         Count = 0;
+        NodeIndex.Reset();
+        bIndexDirty = false;
     }
 
     TNode<T>* Find(std::function<bool(const T&)> Predicate) const
     {
         if (!Head)
         {
-            UE_LOG(LogTemp, Verbose, TEXT("TempLinkedList::Find - List is empty"));
+            UE_LOG(LogGADERaceNav, Verbose, TEXT("TempLinkedList::Find - List is empty"));
             return nullptr;
         }
 
@@ -125,4 +234,39 @@ public:
     }
 
     TNode<T>* GetHead() const { return Head; }
+
+private:
+    // Resolved on every use rather than cached, see SharedPool
+    FNodePool& GetPool() { return SharedPool ? *SharedPool : LocalPool; }
+    const FNodePool& GetPool() const { return SharedPool ? *SharedPool : LocalPool; }
+
+    void RebuildIndex() const
+    {
+        NodeIndex.Reset(Count);
+        for (TNode<T>* Current = Head; Current; Current = Current->Next)
+        {
+            NodeIndex.Add(Current);
+        }
+        bIndexDirty = false;
+    }
+
+    void CopyFrom(const TempLinkedList& Other)
+    {
+        TNode<T>* Last = nullptr;
+        for (TNode<T>* Current = Other.Head; Current; Current = Current->Next)
+        {
+            TNode<T>* NewNode = GetPool().Acquire(Current->Data);
+            if (Last)
+            {
+                Last->Next = NewNode;
+            }
+            else
+            {
+                Head = NewNode;
+            }
+            Last = NewNode;
+        }
+        Tail = Last;
+        Count = Other.Count;
+    }
 };
\ No newline at end of file
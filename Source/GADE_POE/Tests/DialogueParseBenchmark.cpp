@@ -0,0 +1,159 @@
+/**
+ DialogueParseBenchmark
+
+ Compares UDialogue_Data::ParseDialogueJson, the token stream parser, with the DOM path
+ it replaced (FJsonSerializer into FJsonValues, then FJsonObjectConverter per entry) on
+ every JSON file in Content/JSONFILES. Both must produce the same items. Each file is
+ then repeated into a multi-megabyte array, the size of a localisation dump, to time them.
+
+ Runs headless from the editor build:
+   UnrealEditor-Cmd GADE_POE.uproject -nullrhi -unattended -nosplash
+     -ExecCmds="Automation RunTests GADE_POE.Dialogue.ParseBenchmark; Quit"
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "JsonObjectConverter.h"
+#include "Dialogue_Data.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DialogueParseBenchmark
+{
+    constexpr int32 MinBenchmarkChars = 4 * 1024 * 1024;
+    constexpr double TargetSpeedup = 5.0;
+
+    /** The DOM load as it was before the token stream, without its per-entry logging */
+    bool ParseWithDom(const FString& JsonString, TArray<FDialogue_Item>& OutItems)
+    {
+        OutItems.Reset();
+
+        TArray<TSharedPtr<FJsonValue>> JsonArray;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+        if (!FJsonSerializer::Deserialize(Reader, JsonArray))
+        {
+            return false;
+        }
+
+        for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray)
+        {
+            if (!JsonValue.IsValid() || !JsonValue->AsObject().IsValid())
+            {
+                continue;
+            }
+
+            FDialogue_Item DialogueItem;
+            if (FJsonObjectConverter::JsonObjectToUStruct(JsonValue->AsObject().ToSharedRef(), &DialogueItem))
+            {
+                OutItems.Add(DialogueItem);
+            }
+        }
+        return true;
+    }
+
+    bool SameItem(const FDialogue_Item& A, const FDialogue_Item& B)
+    {
+        return A.Name == B.Name && A.SpeakerName == B.SpeakerName && A.SpeakerPortrait == B.SpeakerPortrait
+            && A.DialogueText == B.DialogueText && A.Age == B.Age;
+    }
+
+    /** The file's entries repeated into one array of at least MinBenchmarkChars */
+    FString MakeLargeInput(const FString& JsonString)
+    {
+        const int32 First = JsonString.Find(TEXT("["));
+        const int32 Last = JsonString.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+        const FString Entries = JsonString.Mid(First + 1, Last - First - 1).TrimStartAndEnd();
+        if (Entries.IsEmpty())
+        {
+            return FString();
+        }
+
+        const int32 Copies = FMath::DivideAndRoundUp(MinBenchmarkChars, Entries.Len() + 1);
+        FString Large;
+        Large.Reserve(Copies * (Entries.Len() + 1) + 2);
+        Large += TEXT("[");
+        for (int32 i = 0; i < Copies; i++)
+        {
+            if (i > 0)
+            {
+                Large += TEXT(",");
+            }
+            Large += Entries;
+        }
+        Large += TEXT("]");
+        return Large;
+    }
+
+    template<typename ParseFunc>
+    double TimeParse(const FString& JsonString, TArray<FDialogue_Item>& OutItems, ParseFunc Parse)
+    {
+        const double Start = FPlatformTime::Seconds();
+        Parse(JsonString, OutItems);
+        return (FPlatformTime::Seconds() - Start) * 1000.0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDialogueParseBenchmarkTest, "GADE_POE.Dialogue.ParseBenchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FDialogueParseBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace DialogueParseBenchmark;
+
+    const FString JsonDir = FPaths::ProjectContentDir() / TEXT("JSONFILES");
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *(JsonDir / TEXT("*.json")), true, false);
+    if (!TestTrue(TEXT("Content/JSONFILES has dialogue files"), FileNames.Num() > 0))
+    {
+        return false;
+    }
+
+    for (const FString& FileName : FileNames)
+    {
+        FString JsonString;
+        if (!TestTrue(FString::Printf(TEXT("%s can be read"), *FileName), FFileHelper::LoadFileToString(JsonString, *(JsonDir / FileName))))
+        {
+            continue;
+        }
+
+        // Same items, field for field, in the same order
+        TArray<FDialogue_Item> DomItems;
+        TArray<FDialogue_Item> StreamItems;
+        TestTrue(FString::Printf(TEXT("%s parses through the DOM"), *FileName), ParseWithDom(JsonString, DomItems));
+        TestTrue(FString::Printf(TEXT("%s parses as a token stream"), *FileName), UDialogue_Data::ParseDialogueJson(JsonString, StreamItems));
+        if (!TestEqual(FString::Printf(TEXT("%s item count"), *FileName), StreamItems.Num(), DomItems.Num()))
+        {
+            continue;
+        }
+        for (int32 i = 0; i < DomItems.Num(); i++)
+        {
+            TestTrue(FString::Printf(TEXT("%s item %d matches"), *FileName, i), SameItem(StreamItems[i], DomItems[i]));
+        }
+
+        const FString Large = MakeLargeInput(JsonString);
+        if (Large.IsEmpty())
+        {
+            continue; // nothing to repeat
+        }
+
+        const double DomMs = TimeParse(Large, DomItems, &ParseWithDom);
+        const double StreamMs = TimeParse(Large, StreamItems, &UDialogue_Data::ParseDialogueJson);
+        TestEqual(FString::Printf(TEXT("%s repeated item count"), *FileName), StreamItems.Num(), DomItems.Num());
+
+        const double Speedup = DomMs / FMath::Max(StreamMs, 0.001);
+        AddInfo(FString::Printf(TEXT("%s, %d items (%.1f MB): DOM %.2f ms, token stream %.2f ms (%.1fx)"),
+            *FileName, DomItems.Num(), Large.Len() * sizeof(TCHAR) / (1024.0 * 1024.0), DomMs, StreamMs, Speedup));
+        if (Speedup < TargetSpeedup)
+        {
+            AddWarning(FString::Printf(TEXT("%s: token stream is %.1fx faster than the DOM, short of the %.0fx target"), *FileName, Speedup, TargetSpeedup));
+        }
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,110 @@
+/**
+ RaceLogOverheadBenchmark
+
+ Times one simulated frame of the race's per-racer logging, as it was and as it is now.
+ Before, every AI racer wrote its five nav mesh status lines and a leaderboard line each
+ tick, formatted and sent to every output device. Now the same call sites are Verbose on
+ LogGADERaceAI, compiled out in test and shipping and skipped before formatting in
+ development, and the one line that can still fire is rate limited.
+
+ Runs headless from the editor build:
+   UnrealEditor-Cmd GADE_POE.uproject -nullrhi -unattended -nosplash
+     -ExecCmds="Automation RunTests GADE_POE.Logging.HotPathOverhead; Quit"
+
+ For whole-frame numbers, run a race twice with the CSV profiler and compare FrameTime,
+ once as is and once with the hot categories opened back up:
+   UnrealEditor GADE_POE.uproject AdvancedMap -game -nullrhi -unattended -csvprofile -ExecCmds="stat unit"
+   UnrealEditor GADE_POE.uproject AdvancedMap -game -nullrhi -unattended -csvprofile -ExecCmds="stat unit"
+     -LogCmds="LogGADERace Verbose, LogGADERaceAI Verbose, LogGADERaceNav Verbose"
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "GADE_POE.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Stands in for the old LogTemp warnings: same formatting and output devices, but Log
+// verbosity so the automation framework doesn't collect every line as a test warning
+DEFINE_LOG_CATEGORY_STATIC(LogGADELogBenchmark, Log, All);
+
+namespace RaceLogOverheadBenchmark
+{
+    constexpr int32 RacerCounts[] = { 16, 64, 256 };
+    constexpr int32 Frames = 60;
+
+    struct FFakeRacer
+    {
+        FString Name;
+        float Height;
+        float NavHeight;
+        int32 Lap;
+        int32 WaypointIndex;
+    };
+
+    void LogFrameBefore(const TArray<FFakeRacer>& Racers)
+    {
+        for (int32 i = 0; i < Racers.Num(); i++)
+        {
+            const FFakeRacer& Racer = Racers[i];
+            UE_LOG(LogGADELogBenchmark, Log, TEXT("AIRacer %s Nav Mesh Status:"), *Racer.Name);
+            UE_LOG(LogGADELogBenchmark, Log, TEXT("  - On Nav Mesh: %s"), TEXT("Yes"));
+            UE_LOG(LogGADELogBenchmark, Log, TEXT("  - Current Height: %.2f"), Racer.Height);
+            UE_LOG(LogGADELogBenchmark, Log, TEXT("  - Nav Mesh Height: %.2f"), Racer.NavHeight);
+            UE_LOG(LogGADELogBenchmark, Log, TEXT("  - Height Difference: %.2f"), Racer.Height - Racer.NavHeight);
+            UE_LOG(LogGADELogBenchmark, Log, TEXT("BeginnerRaceGameState: Racer %s - Lap: %d, Waypoint: %d, Position: %d"),
+                *Racer.Name, Racer.Lap, Racer.WaypointIndex, i + 1);
+        }
+    }
+
+    void LogFrameAfter(const TArray<FFakeRacer>& Racers)
+    {
+        for (int32 i = 0; i < Racers.Num(); i++)
+        {
+            const FFakeRacer& Racer = Racers[i];
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("AIRacer %s Nav Mesh Status:"), *Racer.Name);
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("  - On Nav Mesh: %s"), TEXT("Yes"));
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Current Height: %.2f"), Racer.Height);
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Nav Mesh Height: %.2f"), Racer.NavHeight);
+            UE_LOG(LogGADERaceAI, Verbose, TEXT("  - Height Difference: %.2f"), Racer.Height - Racer.NavHeight);
+            GADE_LOG_RATE_LIMITED(LogGADELogBenchmark, Log, 1.0, TEXT("AIRacer %s may be off nav mesh or too far above/below it (%.2f)"),
+                *Racer.Name, Racer.Height - Racer.NavHeight);
+        }
+    }
+
+    template<typename LogFunc>
+    double TimeFrames(const TArray<FFakeRacer>& Racers, LogFunc LogFrame)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Frame = 0; Frame < Frames; Frame++)
+        {
+            LogFrame(Racers);
+        }
+        return (FPlatformTime::Seconds() - Start) * 1000.0 / Frames;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRaceLogOverheadBenchmarkTest, "GADE_POE.Logging.HotPathOverhead",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FRaceLogOverheadBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace RaceLogOverheadBenchmark;
+
+    for (const int32 NumRacers : RacerCounts)
+    {
+        TArray<FFakeRacer> Racers;
+        for (int32 i = 0; i < NumRacers; i++)
+        {
+            Racers.Add({ FString::Printf(TEXT("AIRacer_C_%d"), i), 120.0f + i, 100.0f, i % 3, i % 11 });
+        }
+
+        const double BeforeMs = TimeFrames(Racers, &LogFrameBefore);
+        const double AfterMs = TimeFrames(Racers, &LogFrameAfter);
+        AddInfo(FString::Printf(TEXT("%3d racers: per-frame logging %.3f ms before, %.4f ms now (Verbose on LogGADERaceAI is %s)"),
+            NumRacers, BeforeMs, AfterMs, UE_LOG_ACTIVE(LogGADERaceAI, Verbose) ? TEXT("on") : TEXT("off")));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
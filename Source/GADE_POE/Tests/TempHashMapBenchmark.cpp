@@ -0,0 +1,288 @@
+/**
+ TempHashMapBenchmark
+
+ Times the flat Robin Hood TempHashMap against the 64-bucket chained map it replaced,
+ at 1k, 10k and 100k keys. Both maps are filled with the same UObject keys, then read
+ back and half emptied, and every lookup is checked against the value that was added.
+ ListValues checks that TempLinkedList values survive being moved between slots.
+
+ Runs headless from the editor build:
+   UnrealEditor-Cmd GADE_POE.uproject -nullrhi -unattended -nosplash
+     -ExecCmds="Automation RunTests GADE_POE.Containers.TempHashMap; Quit"
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "TempHashMap.h"
+#include "TempLinkedList.h"
+#include "Dialogue_Data.h"
+#include <functional>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace TempHashMapBenchmark
+{
+    /**
+     * The chained map as it was before the flat table: 64 fixed buckets of singly linked nodes,
+     * a heap node per Add appended at the tail, and a std::function predicate that checks
+     * IsValidLowLevel on every node it probes. Logging is left out, valid keys never hit it.
+     */
+    template<typename K, typename V>
+    class TChainedHashMap
+    {
+    public:
+        ~TChainedHashMap() { Clear(); }
+
+        void Add(const K& Key, const V& Value)
+        {
+            if (!Key || !Key->IsValidLowLevel())
+            {
+                return;
+            }
+            FNode*& Head = Buckets[GetBucketIndex(Key)];
+            if (FNode* Node = Find(Head, [Key](const FNode& N) { return N.Key && N.Key->IsValidLowLevel() && Key && Key->IsValidLowLevel() && N.Key == Key; }))
+            {
+                Node->Value = Value;
+                return;
+            }
+
+            FNode* NewNode = new FNode{ Key, Value, nullptr };
+            if (!Head)
+            {
+                Head = NewNode;
+                return;
+            }
+            FNode* Tail = Head;
+            while (Tail->Next)
+            {
+                Tail = Tail->Next;
+            }
+            Tail->Next = NewNode;
+        }
+
+        V* Get(const K& Key) const
+        {
+            if (!Key || !Key->IsValidLowLevel())
+            {
+                return nullptr;
+            }
+            FNode* Node = Find(Buckets[GetBucketIndex(Key)], [Key](const FNode& N) { return N.Key && N.Key->IsValidLowLevel() && N.Key == Key; });
+            return Node ? &Node->Value : nullptr;
+        }
+
+        void Remove(const K& Key)
+        {
+            if (!Key || !Key->IsValidLowLevel())
+            {
+                return;
+            }
+            const std::function<bool(const FNode&)> Predicate = [Key](const FNode& N) { return N.Key && N.Key->IsValidLowLevel() && Key && Key->IsValidLowLevel() && N.Key == Key; };
+            FNode** Link = &Buckets[GetBucketIndex(Key)];
+            while (*Link)
+            {
+                if (Predicate(**Link))
+                {
+                    FNode* Removed = *Link;
+                    *Link = Removed->Next;
+                    delete Removed;
+                }
+                else
+                {
+                    Link = &(*Link)->Next;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            for (FNode*& Head : Buckets)
+            {
+                while (Head)
+                {
+                    FNode* Next = Head->Next;
+                    delete Head;
+                    Head = Next;
+                }
+            }
+        }
+
+    private:
+        struct FNode
+        {
+            K Key;
+            V Value;
+            FNode* Next;
+        };
+
+        static constexpr int32 BucketCount = 64;
+        FNode* Buckets[BucketCount] = {};
+
+        static int32 GetBucketIndex(const K& Key)
+        {
+            return (Key && Key->IsValidLowLevel()) ? (GetTypeHash(Key) & (BucketCount - 1)) : 0;
+        }
+
+        static FNode* Find(FNode* Head, std::function<bool(const FNode&)> Predicate)
+        {
+            for (FNode* Current = Head; Current; Current = Current->Next)
+            {
+                if (Predicate(*Current))
+                {
+                    return Current;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    /** Milliseconds spent in each phase of one run */
+    struct FTimings
+    {
+        double AddMs = 0.0;
+        double GetMs = 0.0;
+        double RemoveMs = 0.0;
+    };
+
+    static constexpr int32 LookupPasses = 4;
+
+    /** Fills, reads back and half empties Map, false if any lookup returned the wrong value */
+    template<typename MapType>
+    bool Run(MapType& Map, const TArray<UObject*>& Keys, FTimings& OutTimings)
+    {
+        bool bCorrect = true;
+
+        double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Keys.Num(); i++)
+        {
+            Map.Add(Keys[i], i);
+        }
+        OutTimings.AddMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 Pass = 0; Pass < LookupPasses; Pass++)
+        {
+            for (int32 i = 0; i < Keys.Num(); i++)
+            {
+                const int32* Value = Map.Get(Keys[i]);
+                bCorrect &= Value && *Value == i;
+            }
+        }
+        OutTimings.GetMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Keys.Num(); i += 2)
+        {
+            Map.Remove(Keys[i]);
+        }
+        OutTimings.RemoveMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+        // Removed keys are gone, the rest kept their values through the backward shifts
+        for (int32 i = 0; i < Keys.Num(); i++)
+        {
+            const int32* Value = Map.Get(Keys[i]);
+            bCorrect &= (i % 2 == 0) ? Value == nullptr : (Value && *Value == i);
+        }
+        return bCorrect;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTempHashMapBenchmarkTest, "GADE_POE.Containers.TempHashMap.Benchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTempHashMapBenchmarkTest::RunTest(const FString& Parameters)
+{
+    using namespace TempHashMapBenchmark;
+
+    const int32 KeyCounts[] = { 1000, 10000, 100000 };
+
+    // Any live UObject will do as a key, the maps only hash the pointer and check it is valid
+    TArray<UObject*> Keys;
+    Keys.Reserve(KeyCounts[UE_ARRAY_COUNT(KeyCounts) - 1]);
+    for (int32 i = 0; i < KeyCounts[UE_ARRAY_COUNT(KeyCounts) - 1]; i++)
+    {
+        UObject* Key = NewObject<UDialogue_Data>(GetTransientPackage());
+        Key->AddToRoot(); // nothing else references them while the test runs
+        Keys.Add(Key);
+    }
+
+    for (const int32 NumKeys : KeyCounts)
+    {
+        const TArray<UObject*> RunKeys(Keys.GetData(), NumKeys);
+
+        FTimings Chained;
+        {
+            TChainedHashMap<UObject*, int32> Map;
+            TestTrue(FString::Printf(TEXT("Chained map returns the added values at %d keys"), NumKeys), Run(Map, RunKeys, Chained));
+        }
+
+        FTimings Flat;
+        {
+            TempHashMap<UObject*, int32> Map;
+            TestTrue(FString::Printf(TEXT("Flat map returns the added values at %d keys"), NumKeys), Run(Map, RunKeys, Flat));
+        }
+
+        AddInfo(FString::Printf(TEXT("%6d keys  add %9.2f ms -> %7.2f ms (%5.1fx)  get x%d %9.2f ms -> %7.2f ms (%5.1fx)  remove half %9.2f ms -> %7.2f ms (%5.1fx)"),
+            NumKeys,
+            Chained.AddMs, Flat.AddMs, Chained.AddMs / FMath::Max(Flat.AddMs, 0.001),
+            LookupPasses, Chained.GetMs, Flat.GetMs, Chained.GetMs / FMath::Max(Flat.GetMs, 0.001),
+            Chained.RemoveMs, Flat.RemoveMs, Chained.RemoveMs / FMath::Max(Flat.RemoveMs, 0.001)));
+    }
+
+    for (UObject* Key : Keys)
+    {
+        Key->RemoveFromRoot();
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTempHashMapListValuesTest, "GADE_POE.Containers.TempHashMap.ListValues",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTempHashMapListValuesTest::RunTest(const FString& Parameters)
+{
+    // Lists as values, like AGraph::Nodes. Enough keys that inserts displace earlier slots and
+    // the table rehashes several times, moving every list bitwise. Each list must still add
+    // into its own pool afterwards and read back only its own values.
+    constexpr int32 NumKeys = 4096;
+
+    TArray<UObject*> Keys;
+    Keys.Reserve(NumKeys);
+    TempHashMap<UObject*, TempLinkedList<int32>> Map;
+    for (int32 i = 0; i < NumKeys; i++)
+    {
+        UObject* Key = NewObject<UDialogue_Data>(GetTransientPackage());
+        Key->AddToRoot();
+        Keys.Add(Key);
+
+        TempLinkedList<int32> List;
+        List.Add(i);
+        Map.Add(Key, MoveTemp(List));
+    }
+
+    for (int32 i = 0; i < NumKeys; i++)
+    {
+        if (TempLinkedList<int32>* List = Map.Get(Keys[i]))
+        {
+            List->Add(i + NumKeys);
+        }
+    }
+
+    bool bCorrect = Map.Num() == NumKeys;
+    for (int32 i = 0; i < NumKeys; i++)
+    {
+        const TempLinkedList<int32>* List = Map.Get(Keys[i]);
+        bCorrect &= List && List->GetCount() == 2 && List->GetAt(0) == i && List->GetAt(1) == i + NumKeys
+            && List->GetPoolStats().LiveNodes == 2;
+    }
+    TestTrue(TEXT("Every list keeps its own values after displacement and rehash"), bCorrect);
+
+    Map.Clear();
+    for (UObject* Key : Keys)
+    {
+        Key->RemoveFromRoot();
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
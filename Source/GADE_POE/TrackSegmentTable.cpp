@@ -0,0 +1,50 @@
+#include "TrackSegmentTable.h"
+
+void FTrackSegmentTable::Build(const TArray<FVector>& WaypointLocations)
+{
+    Reset();
+
+    const int32 NumPoints = WaypointLocations.Num();
+    if (NumPoints < 2)
+    {
+        return;
+    }
+
+    SegmentStarts.Reserve(NumPoints);
+    SegmentDirections.Reserve(NumPoints);
+    SegmentLengths.Reserve(NumPoints);
+    DistanceBefore.Reserve(NumPoints);
+
+    for (int32 i = 0; i < NumPoints; i++)
+    {
+        const FVector& Start = WaypointLocations[i == 0 ? NumPoints - 1 : i - 1];
+        const FVector Delta = WaypointLocations[i] - Start;
+        const float Length = Delta.Size();
+
+        SegmentStarts.Add(Start);
+        SegmentDirections.Add(Length > KINDA_SMALL_NUMBER ? Delta / Length : FVector::ZeroVector);
+        SegmentLengths.Add(Length);
+        DistanceBefore.Add(LapLength);
+        LapLength += Length;
+    }
+}
+
+void FTrackSegmentTable::Reset()
+{
+    SegmentStarts.Reset();
+    SegmentDirections.Reset();
+    SegmentLengths.Reset();
+    DistanceBefore.Reset();
+    LapLength = 0.0f;
+}
+
+void FTrackSegmentTable::ComputeProgress(TArrayView<const int32> Laps, TArrayView<const int32> WaypointIndices,
+    TArrayView<const FVector> Locations, TArrayView<float> OutProgress) const
+{
+    check(Laps.Num() == OutProgress.Num() && WaypointIndices.Num() == OutProgress.Num() && Locations.Num() == OutProgress.Num());
+
+    for (int32 i = 0; i < OutProgress.Num(); i++)
+    {
+        OutProgress[i] = Laps[i] + GetLapFraction(WaypointIndices[i], Locations[i]);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Precomputed polyline of a closed track, one segment per waypoint.
+ * Segment k ends at waypoint k and starts at the waypoint before it (the last one for k == 0),
+ * so a racer that has passed k waypoints this lap is somewhere on segment k.
+ * Kept as parallel arrays so the per-frame progress pass walks contiguous memory.
+ */
+struct GADE_POE_API FTrackSegmentTable
+{
+    TArray<FVector> SegmentStarts; // world position the segment starts at
+    TArray<FVector> SegmentDirections; // unit direction, zero for degenerate segments
+    TArray<float> SegmentLengths;
+    TArray<float> DistanceBefore; // lap distance covered at the start of each segment
+    float LapLength = 0.0f;
+
+    /** Rebuilds the table from waypoint locations in track order */
+    void Build(const TArray<FVector>& WaypointLocations);
+
+    void Reset();
+
+    bool IsValid() const { return LapLength > KINDA_SMALL_NUMBER; }
+
+    int32 Num() const { return SegmentLengths.Num(); }
+
+    /** Fraction of the lap [0, 1] for a racer at Location that has passed WaypointIndex waypoints this lap */
+    FORCEINLINE float GetLapFraction(int32 WaypointIndex, const FVector& Location) const
+    {
+        const int32 Segment = WaypointIndex % SegmentLengths.Num();
+        const float Along = FMath::Clamp(static_cast<float>(FVector::DotProduct(Location - SegmentStarts[Segment], SegmentDirections[Segment])),
+            0.0f, SegmentLengths[Segment]);
+        return (DistanceBefore[Segment] + Along) / LapLength;
+    }
+
+    /** Lap plus lap fraction for every racer in one pass. All views must have the same length. */
+    void ComputeProgress(TArrayView<const int32> Laps, TArrayView<const int32> WaypointIndices,
+        TArrayView<const FVector> Locations, TArrayView<float> OutProgress) const;
+};
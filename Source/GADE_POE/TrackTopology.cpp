@@ -0,0 +1,90 @@
+#include "TrackTopology.h"
+#include "GADE_POE.h"
+#include "Misc/DataValidation.h"
+#include "UObject/ObjectSaveContext.h"
+
+#define LOCTEXT_NAMESPACE "TrackTopology"
+
+bool UTrackTopology::Validate(TArray<FText>& OutErrors) const
+{
+    const int32 StartErrors = OutErrors.Num();
+
+    if (Waypoints.Num() == 0)
+    {
+        OutErrors.Add(LOCTEXT("NoWaypoints", "Track has no waypoints."));
+    }
+
+    TSet<FName> Known;
+    for (const FName& Id : Waypoints)
+    {
+        if (Id.IsNone())
+        {
+            OutErrors.Add(LOCTEXT("EmptyId", "Track contains an empty waypoint ID."));
+        }
+        else if (Known.Contains(Id))
+        {
+            OutErrors.Add(FText::Format(LOCTEXT("DuplicateId", "Waypoint ID {0} is listed more than once."), FText::FromName(Id)));
+        }
+        Known.Add(Id);
+    }
+
+    TSet<TPair<FName, FName>> SeenEdges;
+    for (const FTrackTopologyEdge& Edge : Edges)
+    {
+        if (!Known.Contains(Edge.From) || !Known.Contains(Edge.To))
+        {
+            OutErrors.Add(FText::Format(LOCTEXT("UnknownEdgeId", "Edge {0} -> {1} references a waypoint that isn't listed."),
+                FText::FromName(Edge.From), FText::FromName(Edge.To)));
+        }
+        if (Edge.From == Edge.To)
+        {
+            OutErrors.Add(FText::Format(LOCTEXT("SelfEdge", "Edge {0} -> {0} loops back on itself."), FText::FromName(Edge.From)));
+        }
+        if (SeenEdges.Contains(TPair<FName, FName>(Edge.From, Edge.To)))
+        {
+            OutErrors.Add(FText::Format(LOCTEXT("DuplicateEdge", "Edge {0} -> {1} is listed more than once."),
+                FText::FromName(Edge.From), FText::FromName(Edge.To)));
+        }
+        SeenEdges.Add(TPair<FName, FName>(Edge.From, Edge.To));
+    }
+
+    return OutErrors.Num() == StartErrors;
+}
+
+#if WITH_EDITOR
+EDataValidationResult UTrackTopology::IsDataValid(FDataValidationContext& Context) const
+{
+    EDataValidationResult Result = Super::IsDataValid(Context);
+
+    TArray<FText> Errors;
+    if (!Validate(Errors))
+    {
+        for (const FText& Error : Errors)
+        {
+            Context.AddError(Error);
+        }
+        return EDataValidationResult::Invalid;
+    }
+    return Result;
+}
+
+void UTrackTopology::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+    Super::PreSave(ObjectSaveContext);
+
+    // Catch broken layouts at cook time rather than on the first race
+    if (ObjectSaveContext.IsCooking())
+    {
+        TArray<FText> Errors;
+        if (!Validate(Errors))
+        {
+            for (const FText& Error : Errors)
+            {
+                UE_LOG(LogGADERaceNav, Error, TEXT("TrackTopology %s: %s"), *GetName(), *Error.ToString());
+            }
+        }
+    }
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
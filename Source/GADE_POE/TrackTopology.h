@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "TrackTopology.generated.h"
+
+/** Directed connection between two waypoints, referenced by their stable IDs */
+USTRUCT(BlueprintType)
+struct FTrackTopologyEdge
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Track")
+    FName From;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Track")
+    FName To;
+
+    /** Traversal cost, negative to use the distance between the two waypoints */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Track")
+    float Cost = -1.0f;
+};
+
+/**
+ * Track layout for the advanced race, keyed by AWaypoint::GetWaypointId.
+ * Validated when saved and when cooked. Cooking only logs the errors, so the race
+ * manager still skips self and duplicate edges when it builds the graph.
+ */
+UCLASS(BlueprintType)
+class GADE_POE_API UTrackTopology : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /** Waypoint IDs in track order, the first entry is the start/finish line */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Track")
+    TArray<FName> Waypoints;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Track")
+    TArray<FTrackTopologyEdge> Edges;
+
+    /** Checks the layout for empty, duplicate or unknown IDs and self or duplicate edges */
+    bool Validate(TArray<FText>& OutErrors) const;
+
+#if WITH_EDITOR
+    virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+    virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
+};
@@ -1,11 +1,8 @@
 #include "Waypoint.h"
-#include "Kismet/GameplayStatics.h"
-#include "AdvancedRaceManager.h"
-#include "Graph.h"
+#include "GADE_POE.h"
+#include "WaypointRegistrySubsystem.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
-#include "AIRacer.h"
-#include "AIRacerContoller.h"
 
 AWaypoint::AWaypoint()
 {
@@ -14,54 +11,48 @@ AWaypoint::AWaypoint()
     TriggerSphere = CreateDefaultSubobject<USphereComponent>(TEXT("TriggerSphere"));
     RootComponent = TriggerSphere;
     TriggerSphere->SetSphereRadius(200.0f);
-    TriggerSphere->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
-    TriggerSphere->SetGenerateOverlapEvents(true);
+    TriggerSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    TriggerSphere->SetGenerateOverlapEvents(false);
 
     VisualMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("VisualMesh"));
     VisualMesh->SetupAttachment(RootComponent);
     VisualMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-
-    // Bind overlap event
-    TriggerSphere->OnComponentBeginOverlap.AddDynamic(this, &AWaypoint::OnOverlapBegin);
 }
 
-void AWaypoint::BeginPlay()
+float AWaypoint::GetArrivalRadius() const
 {
-    Super::BeginPlay();
-    UE_LOG(LogTemp, Log, TEXT("Waypoint %s: BeginPlay called."), *GetName());
+    return TriggerSphere ? TriggerSphere->GetScaledSphereRadius() : 0.0f;
 }
 
-void AWaypoint::BeginDestroy()
+void AWaypoint::PostInitializeComponents()
 {
+    Super::PostInitializeComponents();
+
+    // Registered before any BeginPlay runs, so managers collecting waypoints see the whole level
     if (UWorld* World = GetWorld())
     {
-        AAdvancedRaceManager* Manager = Cast<AAdvancedRaceManager>(
-            UGameplayStatics::GetActorOfClass(World, AAdvancedRaceManager::StaticClass()));
-        if (Manager && Manager->GetGraph())
+        if (UWaypointRegistrySubsystem* Registry = World->GetSubsystem<UWaypointRegistrySubsystem>())
         {
-            Manager->GetGraph()->RemoveNode(this);
-            UE_LOG(LogTemp, Log, TEXT("Waypoint %s: Removed from AdvancedRaceManager graph."), *GetName());
+            Registry->RegisterWaypoint(this);
         }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("Waypoint %s: Failed to find AdvancedRaceManager or Graph in BeginDestroy."), *GetName());
-        }
-    }
-    else
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Waypoint %s: Null world in BeginDestroy."), *GetName());
     }
-    Super::BeginDestroy();
 }
 
-void AWaypoint::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AWaypoint::BeginPlay()
 {
-    if (AAIRacer* Racer = Cast<AAIRacer>(OtherActor))
+    Super::BeginPlay();
+    UE_LOG(LogGADERaceNav, Verbose, TEXT("Waypoint %s: BeginPlay called."), *GetName());
+}
+
+void AWaypoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Whoever built data on this waypoint's ID, such as the race graph, hears about it from the registry
+    if (UWorld* World = GetWorld())
     {
-        UE_LOG(LogTemp, Log, TEXT("Waypoint %s: Overlapped by AIRacer %s"), *GetName(), *Racer->GetName());
-        if (AAIRacerContoller* Controller = Cast<AAIRacerContoller>(Racer->GetController()))
+        if (UWaypointRegistrySubsystem* Registry = World->GetSubsystem<UWaypointRegistrySubsystem>())
         {
-            Controller->OnWaypointReached(this);
+            Registry->UnregisterWaypoint(this);
         }
     }
-}
\ No newline at end of file
+    Super::EndPlay(EndPlayReason);
+}
@@ -13,18 +13,34 @@ class GADE_POE_API AWaypoint : public AActor
 public:
     AWaypoint();
 
+    /** Stable identifier used by track topology assets. Falls back to the actor name when left empty. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Waypoint")
+    FName WaypointId;
+
+    UFUNCTION(BlueprintCallable, Category = "Waypoint")
+    FName GetWaypointId() const { return WaypointId.IsNone() ? GetFName() : WaypointId; }
+
+    /** Dense runtime ID from UWaypointRegistrySubsystem, INDEX_NONE until the waypoint is registered */
+    UFUNCTION(BlueprintCallable, Category = "Waypoint")
+    int32 GetRegistryId() const { return RegistryId; }
+
+    /** Distance at which a racer counts as having reached this waypoint, the trigger sphere's scaled radius */
+    UFUNCTION(BlueprintCallable, Category = "Waypoint")
+    float GetArrivalRadius() const;
+
 protected:
+    /** Sets the arrival radius, arrivals are detected by UWaypointArrivalSubsystem rather than overlaps */
     UPROPERTY(VisibleAnywhere, Category = "Components")
     class USphereComponent* TriggerSphere;
 
     UPROPERTY(VisibleAnywhere, Category = "Components")
     class UStaticMeshComponent* VisualMesh;
 
+    virtual void PostInitializeComponents() override;
     virtual void BeginPlay() override;
-    virtual void BeginDestroy() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-    UFUNCTION()
-    void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-        UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-        bool bFromSweep, const FHitResult& SweepResult);
+private:
+    friend class UWaypointRegistrySubsystem;
+    int32 RegistryId = INDEX_NONE;
 };
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "WaypointArrivalSubsystem.h"
+#include "GADE_POE.h"
+#include "Waypoint.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/Actor.h"
+
+void UWaypointArrivalSubsystem::Deinitialize()
+{
+    Racers.Reset();
+    Callbacks.Reset();
+    RacerRadii.Reset();
+    Targets.Reset();
+    TargetLocations.Reset();
+    ApproachNormals.Reset();
+    ArrivalRadiiSquared.Reset();
+    CrossingRadiiSquared.Reset();
+    Positions.Reset();
+    PreviousPositions.Reset();
+    Arrived.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UWaypointArrivalSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UWaypointArrivalSubsystem, STATGROUP_Tickables);
+}
+
+void UWaypointArrivalSubsystem::RegisterRacer(AActor* Racer, FOnWaypointArrival OnArrival)
+{
+    if (!Racer || Racers.Contains(Racer))
+    {
+        return;
+    }
+
+    Racers.Add(Racer);
+    Callbacks.Add(MoveTemp(OnArrival));
+    RacerRadii.Add(Racer->GetSimpleCollisionRadius());
+    Targets.Add(nullptr);
+    TargetLocations.AddZeroed();
+    ApproachNormals.AddZeroed();
+    ArrivalRadiiSquared.Add(0.0f);
+    CrossingRadiiSquared.Add(0.0f);
+    Positions.Add(Racer->GetActorLocation());
+    PreviousPositions.Add(Racer->GetActorLocation());
+    Arrived.Add(0);
+}
+
+void UWaypointArrivalSubsystem::UnregisterRacer(AActor* Racer)
+{
+    const int32 Index = Racers.Find(Racer);
+    if (Index != INDEX_NONE)
+    {
+        RemoveRacerAt(Index);
+    }
+}
+
+void UWaypointArrivalSubsystem::RemoveRacerAt(int32 Index)
+{
+    Racers.RemoveAtSwap(Index);
+    Callbacks.RemoveAtSwap(Index);
+    RacerRadii.RemoveAtSwap(Index);
+    Targets.RemoveAtSwap(Index);
+    TargetLocations.RemoveAtSwap(Index);
+    ApproachNormals.RemoveAtSwap(Index);
+    ArrivalRadiiSquared.RemoveAtSwap(Index);
+    CrossingRadiiSquared.RemoveAtSwap(Index);
+    Positions.RemoveAtSwap(Index);
+    PreviousPositions.RemoveAtSwap(Index);
+    Arrived.RemoveAtSwap(Index);
+}
+
+void UWaypointArrivalSubsystem::SetTarget(AActor* Racer, AActor* Waypoint)
+{
+    const int32 Index = Racers.Find(Racer);
+    if (Index == INDEX_NONE || Targets[Index] == Waypoint)
+    {
+        return;
+    }
+
+    Targets[Index] = Waypoint;
+    if (!Waypoint)
+    {
+        return;
+    }
+
+    const FVector RacerLocation = Racer->GetActorLocation();
+    const float Radius = GetArrivalRadius(Waypoint) + RacerRadii[Index];
+    TargetLocations[Index] = Waypoint->GetActorLocation();
+    ApproachNormals[Index] = (TargetLocations[Index] - RacerLocation).GetSafeNormal();
+    ArrivalRadiiSquared[Index] = FMath::Square(Radius);
+    CrossingRadiiSquared[Index] = FMath::Square(Radius * CrossingRadiusScale);
+    PreviousPositions[Index] = RacerLocation; // don't count a crossing from before the target was set
+}
+
+float UWaypointArrivalSubsystem::GetArrivalRadius(const AActor* Waypoint) const
+{
+    if (const AWaypoint* TypedWaypoint = Cast<AWaypoint>(Waypoint))
+    {
+        return TypedWaypoint->GetArrivalRadius();
+    }
+    if (const USphereComponent* Sphere = Waypoint->FindComponentByClass<USphereComponent>())
+    {
+        return Sphere->GetScaledSphereRadius();
+    }
+    return DefaultArrivalRadius;
+}
+
+void UWaypointArrivalSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Drop racers destroyed without unregistering, and targets that have gone
+    for (int32 i = Racers.Num() - 1; i >= 0; i--)
+    {
+        if (!IsValid(Racers[i]))
+        {
+            RemoveRacerAt(i);
+        }
+        else if (Targets[i] && !IsValid(Targets[i]))
+        {
+            Targets[i] = nullptr;
+        }
+    }
+
+    const int32 NumRacers = Racers.Num();
+    if (NumRacers == 0)
+    {
+        return;
+    }
+
+    for (int32 i = 0; i < NumRacers; i++)
+    {
+        Positions[i] = Racers[i]->GetActorLocation();
+    }
+
+    // Only the flat arrays from here on
+    for (int32 i = 0; i < NumRacers; i++)
+    {
+        const FVector ToRacer = Positions[i] - TargetLocations[i];
+        const FVector PreviousToRacer = PreviousPositions[i] - TargetLocations[i];
+        const float Side = FVector::DotProduct(ToRacer, ApproachNormals[i]);
+        const float PreviousSide = FVector::DotProduct(PreviousToRacer, ApproachNormals[i]);
+
+        bool bArrived = ToRacer.SizeSquared() < ArrivalRadiiSquared[i];
+        if (!bArrived && PreviousSide < 0.0f && Side >= 0.0f)
+        {
+            // Crossed the plane this frame, check where the movement went through it
+            const float Alpha = PreviousSide / (PreviousSide - Side);
+            const FVector Crossing = FMath::Lerp(PreviousToRacer, ToRacer, Alpha);
+            bArrived = Crossing.SizeSquared() < CrossingRadiiSquared[i];
+        }
+
+        Arrived[i] = (Targets[i] != nullptr && bArrived) ? 1 : 0;
+        PreviousPositions[i] = Positions[i];
+    }
+
+    // Collected before any callback runs, a callback is free to retarget or unregister racers
+    struct FArrival
+    {
+        TWeakObjectPtr<AActor> Waypoint;
+        FOnWaypointArrival Callback;
+    };
+    TArray<FArrival, TInlineAllocator<16>> Arrivals;
+    for (int32 i = 0; i < NumRacers; i++)
+    {
+        if (Arrived[i])
+        {
+            UE_LOG(LogGADERaceNav, Verbose, TEXT("WaypointArrival: %s reached %s"), *Racers[i]->GetName(), *Targets[i]->GetName());
+            Arrivals.Add({ Targets[i], Callbacks[i] });
+            Targets[i] = nullptr;
+        }
+    }
+
+    for (FArrival& Arrival : Arrivals)
+    {
+        if (AActor* Waypoint = Arrival.Waypoint.Get())
+        {
+            Arrival.Callback.ExecuteIfBound(Waypoint);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ WaypointArrivalSubsystem
+
+ Detects every racer's arrival at its current target waypoint from one tick per frame.
+ Racer positions are gathered into flat arrays and tested against only their own
+ target, by squared distance or by crossing the plane through the waypoint that
+ faces the racer's approach, so a racer moving too fast to land inside the radius
+ on any frame still arrives. Arrivals found in a frame are dispatched together
+ after the scan, and waypoints don't need to generate overlap events at all.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WaypointArrivalSubsystem.generated.h"
+
+/** Called with the waypoint the racer arrived at. Its target is cleared until SetTarget is called again. */
+DECLARE_DELEGATE_OneParam(FOnWaypointArrival, AActor* /*Waypoint*/);
+
+UCLASS()
+class GADE_POE_API UWaypointArrivalSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Starts tracking Racer, OnArrival fires once each time it reaches the target set with SetTarget */
+    void RegisterRacer(AActor* Racer, FOnWaypointArrival OnArrival);
+
+    void UnregisterRacer(AActor* Racer);
+
+    /** Makes Waypoint the only one Racer can arrive at, nullptr stops checking. Setting the same target again keeps its approach. */
+    void SetTarget(AActor* Racer, AActor* Waypoint);
+
+    /** Used for targets that aren't AWaypoints and have no sphere to take the radius from */
+    float DefaultArrivalRadius = 200.0f;
+
+    /** How far from the waypoint, as a multiple of the arrival radius, crossing its plane still counts */
+    float CrossingRadiusScale = 4.0f;
+
+private:
+    UPROPERTY()
+    TArray<AActor*> Racers;
+
+    TArray<FOnWaypointArrival> Callbacks;
+    TArray<float> RacerRadii; // collision radius, added to the waypoint's like the old overlap test
+
+    // Target of each racer, cached when set since waypoints don't move
+    UPROPERTY()
+    TArray<AActor*> Targets;
+    TArray<FVector> TargetLocations;
+    TArray<FVector> ApproachNormals; // from where the racer was when the target was set towards the waypoint
+    TArray<float> ArrivalRadiiSquared;
+    TArray<float> CrossingRadiiSquared;
+
+    // Gathered every frame
+    TArray<FVector> Positions;
+    TArray<FVector> PreviousPositions;
+    TArray<uint8> Arrived;
+
+    float GetArrivalRadius(const AActor* Waypoint) const;
+    void RemoveRacerAt(int32 Index);
+};
@@ -1,6 +1,8 @@
 #include "WaypointManager.h"
+#include "GADE_POE.h"
 #include "Kismet/GameplayStatics.h"
 #include "CustomLinkedList.h"
+#include "RaceWorldSubsystem.h"
 
 AWaypointManager::AWaypointManager() // Constructor
 {
@@ -25,7 +27,7 @@ void AWaypointManager::BeginPlay() // Called when the game starts
 
     if (Waypoints.Num() == 0) // No waypoints found
     {
-        UE_LOG(LogTemp, Warning, TEXT("WaypointManager: No waypoints found."));
+        UE_LOG(LogGADERaceNav, Warning, TEXT("WaypointManager: No waypoints found."));
         return;
     }
 
@@ -51,27 +53,47 @@ void AWaypointManager::BeginPlay() // Called when the game starts
         });
 
     WaypointList->Clear(); // Clear the list
+    TArray<FVector> Locations;
+    Locations.Reserve(Waypoints.Num());
     for (AActor* Waypoint : Waypoints)
     {
         WaypointList->Add(Waypoint);
-        UE_LOG(LogTemp, Log, TEXT("WaypointManager: Added waypoint %s at %s to list"), *Waypoint->GetName(), *Waypoint->GetActorLocation().ToString());
+        Locations.Add(Waypoint->GetActorLocation());
+        UE_LOG(LogGADERaceNav, Verbose, TEXT("WaypointManager: Added waypoint %s at %s to list"), *Waypoint->GetName(), *Waypoint->GetActorLocation().ToString());
     }
 
-    UE_LOG(LogTemp, Log, TEXT("WaypointManager: Found and sorted %d waypoints."), Waypoints.Num());
+    SegmentTable.Build(Locations);
+
+    UE_LOG(LogGADERaceNav, Log, TEXT("WaypointManager: Found and sorted %d waypoints."), Waypoints.Num());
+
+    // Only a populated list is worth handing out
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->RegisterService(this);
+    }
+}
+
+void AWaypointManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (URaceWorldSubsystem* RaceServices = GetWorld()->GetSubsystem<URaceWorldSubsystem>())
+    {
+        RaceServices->UnregisterService(this);
+    }
+    Super::EndPlay(EndPlayReason);
 }
 
 AActor* AWaypointManager::GetWaypoint(int Index) // Get a waypoint by index
 {
     if (!WaypointList) // Check if the list is valid
     {
-        UE_LOG(LogTemp, Warning, TEXT("WaypointManager: WaypointList is null."));
+        UE_LOG(LogGADERaceNav, Warning, TEXT("WaypointManager: WaypointList is null."));
         return nullptr;
     }
 
     AActor* Waypoint = WaypointList->GetAt(Index); // Get the waypoint
     if (!Waypoint)
     {
-        UE_LOG(LogTemp, Warning, TEXT("WaypointManager: No waypoint found at index %d."), Index);
+        GADE_LOG_RATE_LIMITED(LogGADERaceNav, Warning, 1.0, TEXT("WaypointManager: No waypoint found at index %d."), Index);
         return nullptr;
     }
 
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "CustomLinkedList.h"
+#include "TrackSegmentTable.h"
 #include "WaypointManager.generated.h"
 
 UCLASS() //WaypointManager
@@ -19,10 +20,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Waypoints")
     AActor* GetWaypoint(int32 Index);
 
+    /** Track polyline through Waypoints, built once the waypoints are sorted */
+    const FTrackSegmentTable& GetSegmentTable() const { return SegmentTable; }
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     UPROPERTY()
 	UCustomLinkedList* WaypointList; // Linked list to store waypoints
+
+private:
+    FTrackSegmentTable SegmentTable;
 };
\ No newline at end of file
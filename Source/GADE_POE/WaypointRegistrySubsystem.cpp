@@ -0,0 +1,57 @@
+#include "WaypointRegistrySubsystem.h"
+#include "GADE_POE.h"
+#include "Waypoint.h"
+
+int32 UWaypointRegistrySubsystem::RegisterWaypoint(AWaypoint* Waypoint)
+{
+    if (!Waypoint)
+    {
+        return INDEX_NONE;
+    }
+    if (Waypoint->RegistryId != INDEX_NONE)
+    {
+        return Waypoint->RegistryId;
+    }
+
+    const FName Name = Waypoint->GetWaypointId();
+    const int32 Id = Waypoints.Add(Waypoint);
+    Names.Add(Name);
+    if (IdsByName.Contains(Name))
+    {
+        UE_LOG(LogGADERaceNav, Warning, TEXT("WaypointRegistry: %s shares the ID %s with another waypoint"), *Waypoint->GetName(), *Name.ToString());
+    }
+    IdsByName.Add(Name, Id);
+
+    Waypoint->RegistryId = Id;
+    return Id;
+}
+
+void UWaypointRegistrySubsystem::UnregisterWaypoint(AWaypoint* Waypoint)
+{
+    if (!Waypoint || !Waypoints.IsValidIndex(Waypoint->RegistryId) || Waypoints[Waypoint->RegistryId] != Waypoint)
+    {
+        return;
+    }
+
+    const int32 Id = Waypoint->RegistryId;
+    OnWaypointUnregistered.Broadcast(Id, Waypoint);
+
+    Waypoints[Id] = nullptr;
+    if (const int32* Existing = IdsByName.Find(Names[Id]); Existing && *Existing == Id)
+    {
+        IdsByName.Remove(Names[Id]);
+    }
+    Waypoint->RegistryId = INDEX_NONE;
+}
+
+int32 UWaypointRegistrySubsystem::GetWaypointId(const AActor* Actor)
+{
+    const AWaypoint* Waypoint = Cast<AWaypoint>(Actor);
+    return Waypoint ? Waypoint->GetRegistryId() : INDEX_NONE;
+}
+
+int32 UWaypointRegistrySubsystem::FindWaypointId(FName Name) const
+{
+    const int32* Id = IdsByName.Find(Name);
+    return Id ? *Id : INDEX_NONE;
+}
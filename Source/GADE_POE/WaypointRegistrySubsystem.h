@@ -0,0 +1,59 @@
+/**
+ WaypointRegistrySubsystem
+
+ Gives every AWaypoint in the world a dense integer ID when it registers and maps
+ IDs back to actors through flat arrays, so race code can index arrays by waypoint
+ instead of hashing actor pointers. IDs are never reused while the world lives,
+ and each one keeps the waypoint's FName ID next to it so recorded race data can
+ be matched back up to the level on a later load.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WaypointRegistrySubsystem.generated.h"
+
+class AWaypoint;
+
+UCLASS()
+class GADE_POE_API UWaypointRegistrySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Assigns the waypoint the next ID, or returns the one it already has */
+    int32 RegisterWaypoint(AWaypoint* Waypoint);
+
+    /** Frees the waypoint's slot, its ID is not handed out again */
+    void UnregisterWaypoint(AWaypoint* Waypoint);
+
+    /** Waypoint with the given ID, nullptr if it was never registered or has gone */
+    AWaypoint* GetWaypoint(int32 Id) const { return Waypoints.IsValidIndex(Id) ? Waypoints[Id] : nullptr; }
+
+    /** ID of Actor, INDEX_NONE if it isn't a registered waypoint */
+    static int32 GetWaypointId(const AActor* Actor);
+
+    /** The stable FName the ID was registered under */
+    FName GetWaypointName(int32 Id) const { return Names.IsValidIndex(Id) ? Names[Id] : NAME_None; }
+
+    /** Runtime ID for a stable name, e.g. one read back from a recorded race */
+    int32 FindWaypointId(FName Name) const;
+
+    /** One past the highest ID handed out, the size for arrays indexed by waypoint ID */
+    int32 GetNumIds() const { return Waypoints.Num(); }
+
+    /** Indexed by ID, unregistered slots are nullptr */
+    const TArray<AWaypoint*>& GetWaypoints() const { return Waypoints; }
+
+    /** Fired from UnregisterWaypoint before the slot is cleared */
+    DECLARE_MULTICAST_DELEGATE_TwoParams(FOnWaypointUnregistered, int32 /*Id*/, AWaypoint* /*Waypoint*/);
+    FOnWaypointUnregistered OnWaypointUnregistered;
+
+private:
+    UPROPERTY()
+    TArray<AWaypoint*> Waypoints;
+
+    TArray<FName> Names; // parallel to Waypoints
+    TMap<FName, int32> IdsByName;
+};